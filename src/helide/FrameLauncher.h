@@ -0,0 +1,96 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace helide {
+
+// Persistent threads which run frame tasks, the rendering work of a frame is
+// then spread over Embree's own thread pool. A thread is only created when
+// all existing ones are busy, so a steady stream of frames never spawns any.
+struct FrameLauncher
+{
+  FrameLauncher() = default;
+  ~FrameLauncher();
+
+  template <typename FCN>
+  std::future<void> launch(FCN &&fcn);
+
+  // Finish all launched tasks and join the threads
+  void stop();
+
+ private:
+  void run();
+
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  std::deque<std::packaged_task<void()>> m_tasks;
+  std::vector<std::thread> m_threads;
+  size_t m_idleThreads{0};
+  bool m_stopping{false};
+};
+
+// Inlined definitions ////////////////////////////////////////////////////////
+
+inline FrameLauncher::~FrameLauncher()
+{
+  stop();
+}
+
+template <typename FCN>
+inline std::future<void> FrameLauncher::launch(FCN &&fcn)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_tasks.emplace_back(std::forward<FCN>(fcn));
+  auto future = m_tasks.back().get_future();
+  if (m_tasks.size() > m_idleThreads)
+    m_threads.emplace_back(&FrameLauncher::run, this);
+  else
+    m_condition.notify_one();
+  return future;
+}
+
+inline void FrameLauncher::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stopping = true;
+  }
+  m_condition.notify_all();
+
+  for (auto &t : m_threads)
+    t.join();
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_threads.clear();
+  m_stopping = false;
+}
+
+inline void FrameLauncher::run()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (true) {
+    m_idleThreads++;
+    m_condition.wait(lock, [&]() { return m_stopping || !m_tasks.empty(); });
+    m_idleThreads--;
+
+    if (m_tasks.empty())
+      return;
+
+    auto task = std::move(m_tasks.front());
+    m_tasks.pop_front();
+
+    lock.unlock();
+    task();
+    lock.lock();
+  }
+}
+
+} // namespace helide
@@ -218,7 +218,7 @@ int HelideDevice::getProperty(ANARIObject object,
 {
   if (mask == ANARI_WAIT) {
     auto lock = scopeLockObject();
-    deviceState()->waitOnCurrentFrame();
+    deviceState()->waitOnFramesInFlight();
   }
 
   return helium::BaseDevice::getProperty(object, name, type, mem, size, mask);
@@ -247,6 +247,8 @@ HelideDevice::~HelideDevice()
 
   reportMessage(ANARI_SEVERITY_DEBUG, "destroying helide device (%p)", this);
 
+  state.frameLauncher.stop();
+  state.releaseIdentityIndexBuffer();
   rtcReleaseDevice(state.embreeDevice);
 }
 
@@ -259,12 +261,15 @@ void HelideDevice::initDevice()
 
   auto &state = *deviceState();
 
-  int numThreads = 0;
-  const char *numThreadsFromEnv = getenv("HELIDE_NUM_THREADS");
-  if (numThreadsFromEnv)
-    numThreads = std::atoi(numThreadsFromEnv);
-
-  std::string config = "threads=" + std::to_string(numThreads);
+  // Start Embree's thread pool right away so that the first frame does not
+  // pay for it, with affinity Embree also orders workers by NUMA node
+  std::string config = "threads=" + std::to_string(state.numThreads);
+  if (state.threadAffinity)
+    config += ",set_affinity=1";
+  config += ",start_threads=1";
+  reportMessage(ANARI_SEVERITY_DEBUG,
+      "helide::Device Embree configuration: '%s'",
+      config.c_str());
 
   state.anariDevice = (anari::Device)this;
   state.embreeDevice = rtcNewDevice(config.c_str());
@@ -284,6 +289,19 @@ void HelideDevice::initDevice()
       },
       this);
 
+  if (state.embreeDevice) {
+    auto *d = state.embreeDevice;
+    if (rtcGetDeviceProperty(d, RTC_DEVICE_PROPERTY_NATIVE_RAY16_SUPPORTED))
+      state.nativeRayPacketSize = 16;
+    else if (rtcGetDeviceProperty(d, RTC_DEVICE_PROPERTY_NATIVE_RAY8_SUPPORTED))
+      state.nativeRayPacketSize = 8;
+    else if (rtcGetDeviceProperty(d, RTC_DEVICE_PROPERTY_NATIVE_RAY4_SUPPORTED))
+      state.nativeRayPacketSize = 4;
+    reportMessage(ANARI_SEVERITY_DEBUG,
+        "helide native ray packet size: %i",
+        state.nativeRayPacketSize);
+  }
+
   m_initialized = true;
 }
 
@@ -298,8 +316,42 @@ void HelideDevice::deviceCommitParameters()
   state.invalidMaterialColor =
       getParam<float4>("invalidMaterialColor", float4(1.f, 0.f, 1.f, 1.f));
 
-  if (allowInvalidSurfaceMaterials != state.allowInvalidSurfaceMaterials)
-    state.objectUpdates.lastBLSReconstructSceneRequest = helium::newTimeStamp();
+  // Embree's thread pool is set up once, when the device is initialized
+  int numThreads = 0;
+  if (const char *numThreadsFromEnv = getenv("HELIDE_NUM_THREADS"))
+    numThreads = std::atoi(numThreadsFromEnv);
+  numThreads = std::max(getParam<int>("numThreads", numThreads), 0);
+  const bool threadAffinity = getParam<bool>("threadAffinity", false);
+  if (!m_initialized) {
+    state.numThreads = numThreads;
+    state.threadAffinity = threadAffinity;
+  } else if (numThreads != state.numThreads
+      || threadAffinity != state.threadAffinity) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "'numThreads' and 'threadAffinity' on ANARIDevice are ignored after "
+        "the device was initialized");
+  }
+
+  // Frames pick this up when they are (re)committed
+  state.numaFirstTouch = getParam<bool>("numaFirstTouch", false);
+
+  // Groups and geometries pick these up when they are (re)committed
+  state.bvhDefaults = EmbreeBVHSettings{};
+  if (!readEmbreeBVHSettings(*this, state.bvhDefaults)) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "unknown 'bvhBuildQuality' on ANARIDevice, using 'medium'");
+  }
+  reportMessage(ANARI_SEVERITY_DEBUG,
+      "helide::Device default BVH settings: %s",
+      toString(state.bvhDefaults).c_str());
+
+  if (allowInvalidSurfaceMaterials != state.allowInvalidSurfaceMaterials) {
+    // Surface validity changed everywhere, so every group must be rebuilt
+    auto &updates = state.objectUpdates;
+    const auto now = helium::newTimeStamp();
+    updates.lastBLSReconstructAllRequest = now;
+    updates.lastBLSReconstructSceneRequest = now;
+  }
 
   helium::BaseDevice::deviceCommitParameters();
 }
@@ -31,7 +31,7 @@ static int subtype_hash(const char *str) {
    return -1;
 }
 static int param_hash(const char *str) {
-   static const uint32_t table[] = {0x756c0017u,0x62610089u,0x70610093u,0x6a6100ebu,0x7a7900ffu,0x73610111u,0x736501a0u,0x666501b9u,0x6f6401bfu,0x0u,0x0u,0x6a69028du,0x70610292u,0x666102abu,0x767002b6u,0x736f02ddu,0x0u,0x6661032du,0x7669033eu,0x736103c4u,0x716e0404u,0x70610413u,0x736f04dbu,0x716c0020u,0x6362004fu,0x0u,0x0u,0x0u,0x0u,0x73720071u,0x71700075u,0x7574007au,0x706f0025u,0x0u,0x0u,0x0u,0x69680038u,0x78770026u,0x4a490027u,0x6f6e0028u,0x77760029u,0x6261002au,0x6d6c002bu,0x6a69002cu,0x6564002du,0x4e4d002eu,0x6261002fu,0x75740030u,0x66650031u,0x73720032u,0x6a690033u,0x62610034u,0x6d6c0035u,0x74730036u,0x1000037u,0x80000000u,0x62610039u,0x4e43003au,0x76750045u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f004bu,0x75740046u,0x706f0047u,0x67660048u,0x67660049u,0x100004au,0x80000001u,0x6564004cu,0x6665004du,0x100004eu,0x80000002u,0x6a690050u,0x66650051u,0x6f6e0052u,0x75740053u,0x53430054u,0x706f0064u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610069u,0x6d6c0065u,0x706f0066u,0x73720067u,0x1000068u,0x80000003u,0x6564006au,0x6a69006bu,0x6261006cu,0x6f6e006du,0x6463006eu,0x6665006fu,0x1000070u,0x80000004u,0x62610072u,0x7a790073u,0x1000074u,0x80000005u,0x66650076u,0x64630077u,0x75740078u,0x1000079u,0x80000006u,0x7372007bu,0x6a69007cu,0x6362007du,0x7675007eu,0x7574007fu,0x66650080u,0x34300081u,0x1000085u,0x1000086u,0x1000087u,0x1000088u,0x80000007u,0x80000008u,0x80000009u,0x8000000au,0x6463008au,0x6c6b008bu,0x6867008cu,0x7372008du,0x706f008eu,0x7675008fu,0x6f6e0090u,0x65640091u,0x1000092u,0x8000000bu,0x716d00a2u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626100acu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c00e7u,0x666500a6u,0x0u,0x0u,0x747300aau,0x737200a7u,0x626100a8u,0x10000a9u,0x8000000cu,0x10000abu,0x8000000du,0x6f6e00adu,0x6f6e00aeu,0x666500afu,0x6d6c00b0u,0x2f2e00b1u,0x716300b2u,0x706f00c0u,0x666500c5u,0x0u,0x0u,0x0u,0x0u,0x6f6e00cau,0x0u,0x0u,0x0u,0x0u,0x0u,0x636200d4u,0x737200dcu,0x6d6c00c1u,0x706f00c2u,0x737200c3u,0x10000c4u,0x8000000eu,0x717000c6u,0x757400c7u,0x696800c8u,0x10000c9u,0x8000000fu,0x747300cbu,0x757400ccu,0x626100cdu,0x6f6e00ceu,0x646300cfu,0x666500d0u,0x4a4900d1u,0x656400d2u,0x10000d3u,0x80000010u,0x6b6a00d5u,0x666500d6u,0x646300d7u,0x757400d8u,0x4a4900d9u,0x656400dau,0x10000dbu,0x80000011u,0x6a6900ddu,0x6e6d00deu,0x6a6900dfu,0x757400e0u,0x6a6900e1u,0x777600e2u,0x666500e3u,0x4a4900e4u,0x656400e5u,0x10000e6u,0x80000012u,0x706f00e8u,0x737200e9u,0x10000eau,0x80000013u,0x757400f4u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x737200f7u,0x626100f5u,0x10000f6u,0x80000014u,0x666500f8u,0x646300f9u,0x757400fau,0x6a6900fbu,0x706f00fcu,0x6f6e00fdu,0x10000feu,0x80000015u,0x66650100u,0x4d4c0101u,0x6a690102u,0x68670103u,0x69680104u,0x75740105u,0x43420106u,0x6d6c0107u,0x66650108u,0x6f6e0109u,0x6564010au,0x5352010bu,0x6261010cu,0x7574010du,0x6a69010eu,0x706f010fu,0x1000110u,0x80000016u,0x73720123u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c0125u,0x0u,0x0u,0x0u,0x0u,0x0u,0x7776012au,0x0u,0x0u,0x6261012du,0x1000124u,0x80000017u,0x75740126u,0x66650127u,0x73720128u,0x1000129u,0x80000018u,0x7a79012bu,0x100012cu,0x80000019u,0x6e6d012eu,0x6665012fu,0x44430130u,0x706f0131u,0x6e6d0132u,0x71700133u,0x6d6c0134u,0x66650135u,0x75740136u,0x6a690137u,0x706f0138u,0x6f6e0139u,0x4443013au,0x6261013bu,0x6d6c013cu,0x6d6c013du,0x6362013eu,0x6261013fu,0x64630140u,0x6c6b0141u,0x56000142u,0x8000001au,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x74730198u,0x66650199u,0x7372019au,0x4544019bu,0x6261019cu,0x7574019du,0x6261019eu,0x100019fu,0x8000001bu,0x706f01aeu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f01b5u,0x6e6d01afu,0x666501b0u,0x757401b1u,0x737201b2u,0x7a7901b3u,0x10001b4u,0x8000001cu,0x767501b6u,0x717001b7u,0x10001b8u,0x8000001du,0x6a6901bau,0x686701bbu,0x696801bcu,0x757401bdu,0x10001beu,0x8000001eu,0x10001cau,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626101cbu,0x77410227u,0x8000001fu,0x686701ccu,0x666501cdu,0x530001ceu,0x80000020u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x66650221u,0x68670222u,0x6a690223u,0x706f0224u,0x6f6e0225u,0x1000226u,0x80000021u,0x7574025du,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x67660266u,0x0u,0x0u,0x0u,0x0u,0x7372026cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x75740275u,0x0u,0x0u,0x6261027bu,0x7574025eu,0x7372025fu,0x6a690260u,0x63620261u,0x76750262u,0x75740263u,0x66650264u,0x1000265u,0x80000022u,0x67660267u,0x74730268u,0x66650269u,0x7574026au,0x100026bu,0x80000023u,0x6261026du,0x6f6e026eu,0x7473026fu,0x67660270u,0x706f0271u,0x73720272u,0x6e6d0273u,0x1000274u,0x80000024u,0x62610276u,0x6f6e0277u,0x64630278u,0x66650279u,0x100027au,0x80000025u,0x6d6c027cu,0x6a69027du,0x6564027eu,0x4e4d027fu,0x62610280u,0x75740281u,0x66650282u,0x73720283u,0x6a690284u,0x62610285u,0x6d6c0286u,0x44430287u,0x706f0288u,0x6d6c0289u,0x706f028au,0x7372028bu,0x100028cu,0x80000026u,0x6867028eu,0x6968028fu,0x75740290u,0x1000291u,0x80000027u,0x757402a1u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x656402a8u,0x666502a2u,0x737202a3u,0x6a6902a4u,0x626102a5u,0x6d6c02a6u,0x10002a7u,0x80000028u,0x666502a9u,0x10002aau,0x80000029u,0x6e6d02b0u,0x0u,0x0u,0x0u,0x626102b3u,0x666502b1u,0x10002b2u,0x8000002au,0x737202b4u,0x10002b5u,0x8000002bu,0x626102bcu,0x0u,0x6a6902c2u,0x0u,0x0u,0x757402c7u,0x646302bdu,0x6a6902beu,0x757402bfu,0x7a7902c0u,0x10002c1u,0x8000002cu,0x686702c3u,0x6a6902c4u,0x6f6e02c5u,0x10002c6u,0x8000002du,0x554f02c8u,0x676602ceu,0x0u,0x0u,0x0u,0x0u,0x737202d4u,0x676602cfu,0x747302d0u,0x666502d1u,0x757402d2u,0x10002d3u,0x8000002eu,0x626102d5u,0x6f6e02d6u,0x747302d7u,0x676602d8u,0x706f02d9u,0x737202dau,0x6e6d02dbu,0x10002dcu,0x8000002fu,0x747302e1u,0x0u,0x0u,0x6a6902e8u,0x6a6902e2u,0x757402e3u,0x6a6902e4u,0x706f02e5u,0x6f6e02e6u,0x10002e7u,0x80000030u,0x6e6d02e9u,0x6a6902eau,0x757402ebu,0x6a6902ecu,0x777602edu,0x666502eeu,0x2f2e02efu,0x736102f0u,0x75740302u,0x0u,0x706f0312u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6f640317u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610327u,0x75740303u,0x73720304u,0x6a690305u,0x63620306u,0x76750307u,0x75740308u,0x66650309u,0x3430030au,0x100030eu,0x100030fu,0x1000310u,0x1000311u,0x80000031u,0x80000032u,0x80000033u,0x80000034u,0x6d6c0313u,0x706f0314u,0x73720315u,0x1000316u,0x80000035u,0x1000322u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x65640323u,0x80000036u,0x66650324u,0x79780325u,0x1000326u,0x80000037u,0x65640328u,0x6a690329u,0x7675032au,0x7473032bu,0x100032cu,0x80000038u,0x65640332u,0x0u,0x0u,0x0u,0x6f6e0337u,0x6a690333u,0x76750334u,0x74730335u,0x1000336u,0x80000039u,0x65640338u,0x66650339u,0x7372033au,0x6665033bu,0x7372033cu,0x100033du,0x8000003au,0x7b7a034bu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261034eu,0x0u,0x0u,0x0u,0x62610354u,0x737203beu,0x6665034cu,0x100034du,0x8000003bu,0x6463034fu,0x6a690350u,0x6f6e0351u,0x68670352u,0x1000353u,0x8000003cu,0x75740355u,0x76750356u,0x74730357u,0x44430358u,0x62610359u,0x6d6c035au,0x6d6c035bu,0x6362035cu,0x6261035du,0x6463035eu,0x6c6b035fu,0x56000360u,0x8000003du,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x747303b6u,0x666503b7u,0x737203b8u,0x454403b9u,0x626103bau,0x757403bbu,0x626103bcu,0x10003bdu,0x8000003eu,0x676603bfu,0x626103c0u,0x646303c1u,0x666503c2u,0x10003c3u,0x8000003fu,0x747303d6u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626103fcu,0x6c6b03d7u,0x484703d8u,0x737203d9u,0x626103dau,0x6a6903dbu,0x6f6e03dcu,0x545303ddu,0x6a6903deu,0x7b7a03dfu,0x666503e0u,0x584803e1u,0x666503f1u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a6903f7u,0x6a6903f2u,0x686703f3u,0x696803f4u,0x757403f5u,0x10003f6u,0x80000040u,0x656403f8u,0x757403f9u,0x696803fau,0x10003fbu,0x80000041u,0x6f6e03fdu,0x747303feu,0x676603ffu,0x706f0400u,0x73720401u,0x6e6d0402u,0x1000403u,0x80000042u,0x6a690407u,0x0u,0x1000412u,0x75740408u,0x45440409u,0x6a69040au,0x7473040bu,0x7574040cu,0x6261040du,0x6f6e040eu,0x6463040fu,0x66650410u,0x1000411u,0x80000043u,0x80000044u,0x6d6c0422u,0x0u,0x0u,0x0u,0x7372047du,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c04d6u,0x76750423u,0x66650424u,0x53000425u,0x80000045u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610478u,0x6f6e0479u,0x6867047au,0x6665047bu,0x100047cu,0x80000046u,0x7574047eu,0x6665047fu,0x79780480u,0x2f2e0481u,0x75610482u,0x75740496u,0x0u,0x706104a6u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f04bbu,0x0u,0x706f04c1u,0x0u,0x626104c9u,0x0u,0x626104cfu,0x75740497u,0x73720498u,0x6a690499u,0x6362049au,0x7675049bu,0x7574049cu,0x6665049du,0x3430049eu,0x10004a2u,0x10004a3u,0x10004a4u,0x10004a5u,0x80000047u,0x80000048u,0x80000049u,0x8000004au,0x717004b5u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c04b7u,0x10004b6u,0x8000004bu,0x706f04b8u,0x737204b9u,0x10004bau,0x8000004cu,0x737204bcu,0x6e6d04bdu,0x626104beu,0x6d6c04bfu,0x10004c0u,0x8000004du,0x747304c2u,0x6a6904c3u,0x757404c4u,0x6a6904c5u,0x706f04c6u,0x6f6e04c7u,0x10004c8u,0x8000004eu,0x656404cau,0x6a6904cbu,0x767504ccu,0x747304cdu,0x10004ceu,0x8000004fu,0x6f6e04d0u,0x686704d1u,0x666504d2u,0x6f6e04d3u,0x757404d4u,0x10004d5u,0x80000050u,0x767504d7u,0x6e6d04d8u,0x666504d9u,0x10004dau,0x80000051u,0x737204dfu,0x0u,0x0u,0x626104e3u,0x6d6c04e0u,0x656404e1u,0x10004e2u,0x80000052u,0x717004e4u,0x4e4d04e5u,0x706f04e6u,0x656404e7u,0x666504e8u,0x343104e9u,0x10004ecu,0x10004edu,0x10004eeu,0x80000053u,0x80000054u,0x80000055u};
+   static const uint32_t table[] = {0x75630017u,0x7761009du,0x706100eeu,0x6a610146u,0x7a7901acu,0x736101beu,0x7365024du,0x66650266u,0x6f64026cu,0x0u,0x0u,0x6a69033au,0x7061033fu,0x76610358u,0x76700394u,0x736f03bbu,0x0u,0x6661041bu,0x76690465u,0x736104ebu,0x716e0527u,0x70610536u,0x736f0613u,0x64630029u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x716c0034u,0x63620063u,0x0u,0x0u,0x0u,0x0u,0x73720085u,0x71700089u,0x7574008eu,0x7675002au,0x6e6d002bu,0x7675002cu,0x6d6c002du,0x6261002eu,0x7574002fu,0x6a690030u,0x706f0031u,0x6f6e0032u,0x1000033u,0x80000000u,0x706f0039u,0x0u,0x0u,0x0u,0x6968004cu,0x7877003au,0x4a49003bu,0x6f6e003cu,0x7776003du,0x6261003eu,0x6d6c003fu,0x6a690040u,0x65640041u,0x4e4d0042u,0x62610043u,0x75740044u,0x66650045u,0x73720046u,0x6a690047u,0x62610048u,0x6d6c0049u,0x7473004au,0x100004bu,0x80000001u,0x6261004du,0x4e43004eu,0x76750059u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f005fu,0x7574005au,0x706f005bu,0x6766005cu,0x6766005du,0x100005eu,0x80000002u,0x65640060u,0x66650061u,0x1000062u,0x80000003u,0x6a690064u,0x66650065u,0x6f6e0066u,0x75740067u,0x53430068u,0x706f0078u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261007du,0x6d6c0079u,0x706f007au,0x7372007bu,0x100007cu,0x80000004u,0x6564007eu,0x6a69007fu,0x62610080u,0x6f6e0081u,0x64630082u,0x66650083u,0x1000084u,0x80000005u,0x62610086u,0x7a790087u,0x1000088u,0x80000006u,0x6665008au,0x6463008bu,0x7574008cu,0x100008du,0x80000007u,0x7372008fu,0x6a690090u,0x63620091u,0x76750092u,0x75740093u,0x66650094u,0x34300095u,0x1000099u,0x100009au,0x100009bu,0x100009cu,0x80000008u,0x80000009u,0x8000000au,0x8000000bu,0x646300b3u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x696800bcu,0x6c6b00b4u,0x686700b5u,0x737200b6u,0x706f00b7u,0x767500b8u,0x6f6e00b9u,0x656400bau,0x10000bbu,0x8000000cu,0x534200bdu,0x767500ceu,0x706f00dau,0x7a7900e1u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f00e8u,0x6a6900cfu,0x6d6c00d0u,0x656400d1u,0x525100d2u,0x767500d3u,0x626100d4u,0x6d6c00d5u,0x6a6900d6u,0x757400d7u,0x7a7900d8u,0x10000d9u,0x8000000du,0x6e6d00dbu,0x717000dcu,0x626100ddu,0x646300deu,0x757400dfu,0x10000e0u,0x8000000eu,0x6f6e00e2u,0x626100e3u,0x6e6d00e4u,0x6a6900e5u,0x646300e6u,0x10000e7u,0x8000000fu,0x636200e9u,0x767500eau,0x747300ebu,0x757400ecu,0x10000edu,0x80000010u,0x716d00fdu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610107u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c0142u,0x66650101u,0x0u,0x0u,0x74730105u,0x73720102u,0x62610103u,0x1000104u,0x80000011u,0x1000106u,0x80000012u,0x6f6e0108u,0x6f6e0109u,0x6665010au,0x6d6c010bu,0x2f2e010cu,0x7163010du,0x706f011bu,0x66650120u,0x0u,0x0u,0x0u,0x0u,0x6f6e0125u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6362012fu,0x73720137u,0x6d6c011cu,0x706f011du,0x7372011eu,0x100011fu,0x80000013u,0x71700121u,0x75740122u,0x69680123u,0x1000124u,0x80000014u,0x74730126u,0x75740127u,0x62610128u,0x6f6e0129u,0x6463012au,0x6665012bu,0x4a49012cu,0x6564012du,0x100012eu,0x80000015u,0x6b6a0130u,0x66650131u,0x64630132u,0x75740133u,0x4a490134u,0x65640135u,0x1000136u,0x80000016u,0x6a690138u,0x6e6d0139u,0x6a69013au,0x7574013bu,0x6a69013cu,0x7776013du,0x6665013eu,0x4a49013fu,0x65640140u,0x1000141u,0x80000017u,0x706f0143u,0x73720144u,0x1000145u,0x80000018u,0x7574014fu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x737201a4u,0x62610150u,0x4d000151u,0x80000019u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261019eu,0x7a79019fu,0x706f01a0u,0x767501a1u,0x757401a2u,0x10001a3u,0x8000001au,0x666501a5u,0x646301a6u,0x757401a7u,0x6a6901a8u,0x706f01a9u,0x6f6e01aau,0x10001abu,0x8000001bu,0x666501adu,0x4d4c01aeu,0x6a6901afu,0x686701b0u,0x696801b1u,0x757401b2u,0x434201b3u,0x6d6c01b4u,0x666501b5u,0x6f6e01b6u,0x656401b7u,0x535201b8u,0x626101b9u,0x757401bau,0x6a6901bbu,0x706f01bcu,0x10001bdu,0x8000001cu,0x737201d0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c01d2u,0x0u,0x0u,0x0u,0x0u,0x0u,0x777601d7u,0x0u,0x0u,0x626101dau,0x10001d1u,0x8000001du,0x757401d3u,0x666501d4u,0x737201d5u,0x10001d6u,0x8000001eu,0x7a7901d8u,0x10001d9u,0x8000001fu,0x6e6d01dbu,0x666501dcu,0x444301ddu,0x706f01deu,0x6e6d01dfu,0x717001e0u,0x6d6c01e1u,0x666501e2u,0x757401e3u,0x6a6901e4u,0x706f01e5u,0x6f6e01e6u,0x444301e7u,0x626101e8u,0x6d6c01e9u,0x6d6c01eau,0x636201ebu,0x626101ecu,0x646301edu,0x6c6b01eeu,0x560001efu,0x80000020u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x74730245u,0x66650246u,0x73720247u,0x45440248u,0x62610249u,0x7574024au,0x6261024bu,0x100024cu,0x80000021u,0x706f025bu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0262u,0x6e6d025cu,0x6665025du,0x7574025eu,0x7372025fu,0x7a790260u,0x1000261u,0x80000022u,0x76750263u,0x71700264u,0x1000265u,0x80000023u,0x6a690267u,0x68670268u,0x69680269u,0x7574026au,0x100026bu,0x80000024u,0x1000277u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610278u,0x774102d4u,0x80000025u,0x68670279u,0x6665027au,0x5300027bu,0x80000026u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x666502ceu,0x686702cfu,0x6a6902d0u,0x706f02d1u,0x6f6e02d2u,0x10002d3u,0x80000027u,0x7574030au,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x67660313u,0x0u,0x0u,0x0u,0x0u,0x73720319u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x75740322u,0x0u,0x0u,0x62610328u,0x7574030bu,0x7372030cu,0x6a69030du,0x6362030eu,0x7675030fu,0x75740310u,0x66650311u,0x1000312u,0x80000028u,0x67660314u,0x74730315u,0x66650316u,0x75740317u,0x1000318u,0x80000029u,0x6261031au,0x6f6e031bu,0x7473031cu,0x6766031du,0x706f031eu,0x7372031fu,0x6e6d0320u,0x1000321u,0x8000002au,0x62610323u,0x6f6e0324u,0x64630325u,0x66650326u,0x1000327u,0x8000002bu,0x6d6c0329u,0x6a69032au,0x6564032bu,0x4e4d032cu,0x6261032du,0x7574032eu,0x6665032fu,0x73720330u,0x6a690331u,0x62610332u,0x6d6c0333u,0x44430334u,0x706f0335u,0x6d6c0336u,0x706f0337u,0x73720338u,0x1000339u,0x8000002cu,0x6867033bu,0x6968033cu,0x7574033du,0x100033eu,0x8000002du,0x7574034eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x65640355u,0x6665034fu,0x73720350u,0x6a690351u,0x62610352u,0x6d6c0353u,0x1000354u,0x8000002eu,0x66650356u,0x1000357u,0x8000002fu,0x6e6d036du,0x0u,0x0u,0x0u,0x62610370u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6e6d0373u,0x6665036eu,0x100036fu,0x80000030u,0x73720371u,0x1000372u,0x80000031u,0x62540374u,0x69680382u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x47460389u,0x73720383u,0x66650384u,0x62610385u,0x65640386u,0x74730387u,0x1000388u,0x80000032u,0x6a69038au,0x7372038bu,0x7473038cu,0x7574038du,0x5554038eu,0x706f038fu,0x76750390u,0x64630391u,0x69680392u,0x1000393u,0x80000033u,0x6261039au,0x0u,0x6a6903a0u,0x0u,0x0u,0x757403a5u,0x6463039bu,0x6a69039cu,0x7574039du,0x7a79039eu,0x100039fu,0x80000034u,0x686703a1u,0x6a6903a2u,0x6f6e03a3u,0x10003a4u,0x80000035u,0x554f03a6u,0x676603acu,0x0u,0x0u,0x0u,0x0u,0x737203b2u,0x676603adu,0x747303aeu,0x666503afu,0x757403b0u,0x10003b1u,0x80000036u,0x626103b3u,0x6f6e03b4u,0x747303b5u,0x676603b6u,0x706f03b7u,0x737203b8u,0x6e6d03b9u,0x10003bau,0x80000037u,0x747303bfu,0x0u,0x0u,0x6a6503c6u,0x6a6903c0u,0x757403c1u,0x6a6903c2u,0x706f03c3u,0x6f6e03c4u,0x10003c5u,0x80000038u,0x4a4903cbu,0x0u,0x0u,0x0u,0x6e6d03d7u,0x6f6e03ccu,0x757403cdu,0x666503ceu,0x686703cfu,0x737203d0u,0x626103d1u,0x757403d2u,0x6a6903d3u,0x706f03d4u,0x6f6e03d5u,0x10003d6u,0x80000039u,0x6a6903d8u,0x757403d9u,0x6a6903dau,0x777603dbu,0x666503dcu,0x2f2e03ddu,0x736103deu,0x757403f0u,0x0u,0x706f0400u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6f640405u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610415u,0x757403f1u,0x737203f2u,0x6a6903f3u,0x636203f4u,0x767503f5u,0x757403f6u,0x666503f7u,0x343003f8u,0x10003fcu,0x10003fdu,0x10003feu,0x10003ffu,0x8000003au,0x8000003bu,0x8000003cu,0x8000003du,0x6d6c0401u,0x706f0402u,0x73720403u,0x1000404u,0x8000003eu,0x1000410u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x65640411u,0x8000003fu,0x66650412u,0x79780413u,0x1000414u,0x80000040u,0x65640416u,0x6a690417u,0x76750418u,0x74730419u,0x100041au,0x80000041u,0x7a640420u,0x0u,0x0u,0x0u,0x6f6e0445u,0x6a690436u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x5150043au,0x76750437u,0x74730438u,0x1000439u,0x80000042u,0x6261043bu,0x6463043cu,0x6c6b043du,0x6665043eu,0x7574043fu,0x54530440u,0x6a690441u,0x7b7a0442u,0x66650443u,0x1000444u,0x80000043u,0x65640446u,0x66650447u,0x73720448u,0x66520449u,0x6665045du,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x73720463u,0x6867045eu,0x6a69045fu,0x706f0460u,0x6f6e0461u,0x1000462u,0x80000044u,0x1000464u,0x80000045u,0x7b7a0472u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610475u,0x0u,0x0u,0x0u,0x6261047bu,0x737204e5u,0x66650473u,0x1000474u,0x80000046u,0x64630476u,0x6a690477u,0x6f6e0478u,0x68670479u,0x100047au,0x80000047u,0x7574047cu,0x7675047du,0x7473047eu,0x4443047fu,0x62610480u,0x6d6c0481u,0x6d6c0482u,0x63620483u,0x62610484u,0x64630485u,0x6c6b0486u,0x56000487u,0x80000048u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x747304ddu,0x666504deu,0x737204dfu,0x454404e0u,0x626104e1u,0x757404e2u,0x626104e3u,0x10004e4u,0x80000049u,0x676604e6u,0x626104e7u,0x646304e8u,0x666504e9u,0x10004eau,0x8000004au,0x737204fdu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x7372050bu,0x6d6c0518u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261051fu,0x686704feu,0x666504ffu,0x75740500u,0x47460501u,0x73720502u,0x62610503u,0x6e6d0504u,0x66650505u,0x55540506u,0x6a690507u,0x6e6d0508u,0x66650509u,0x100050au,0x8000004bu,0x6665050cu,0x6261050du,0x6564050eu,0x4241050fu,0x67660510u,0x67660511u,0x6a690512u,0x6f6e0513u,0x6a690514u,0x75740515u,0x7a790516u,0x1000517u,0x8000004cu,0x66650519u,0x5453051au,0x6a69051bu,0x7b7a051cu,0x6665051du,0x100051eu,0x8000004du,0x6f6e0520u,0x74730521u,0x67660522u,0x706f0523u,0x73720524u,0x6e6d0525u,0x1000526u,0x8000004eu,0x6a69052au,0x0u,0x1000535u,0x7574052bu,0x4544052cu,0x6a69052du,0x7473052eu,0x7574052fu,0x62610530u,0x6f6e0531u,0x64630532u,0x66650533u,0x1000534u,0x8000004fu,0x80000050u,0x736c0545u,0x0u,0x0u,0x0u,0x737205b5u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c060eu,0x7675054cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a6905a6u,0x6665054du,0x5300054eu,0x80000051u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626105a1u,0x6f6e05a2u,0x686705a3u,0x666505a4u,0x10005a5u,0x80000052u,0x626105a7u,0x6f6e05a8u,0x646305a9u,0x666505aau,0x555405abu,0x696805acu,0x737205adu,0x666505aeu,0x747305afu,0x696805b0u,0x706f05b1u,0x6d6c05b2u,0x656405b3u,0x10005b4u,0x80000053u,0x757405b6u,0x666505b7u,0x797805b8u,0x2f2e05b9u,0x756105bau,0x757405ceu,0x0u,0x706105deu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f05f3u,0x0u,0x706f05f9u,0x0u,0x62610601u,0x0u,0x62610607u,0x757405cfu,0x737205d0u,0x6a6905d1u,0x636205d2u,0x767505d3u,0x757405d4u,0x666505d5u,0x343005d6u,0x10005dau,0x10005dbu,0x10005dcu,0x10005ddu,0x80000054u,0x80000055u,0x80000056u,0x80000057u,0x717005edu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c05efu,0x10005eeu,0x80000058u,0x706f05f0u,0x737205f1u,0x10005f2u,0x80000059u,0x737205f4u,0x6e6d05f5u,0x626105f6u,0x6d6c05f7u,0x10005f8u,0x8000005au,0x747305fau,0x6a6905fbu,0x757405fcu,0x6a6905fdu,0x706f05feu,0x6f6e05ffu,0x1000600u,0x8000005bu,0x65640602u,0x6a690603u,0x76750604u,0x74730605u,0x1000606u,0x8000005cu,0x6f6e0608u,0x68670609u,0x6665060au,0x6f6e060bu,0x7574060cu,0x100060du,0x8000005du,0x7675060fu,0x6e6d0610u,0x66650611u,0x1000612u,0x8000005eu,0x73720617u,0x0u,0x0u,0x6261061bu,0x6d6c0618u,0x65640619u,0x100061au,0x8000005fu,0x7170061cu,0x4e4d061du,0x706f061eu,0x6564061fu,0x66650620u,0x34310621u,0x1000624u,0x1000625u,0x1000626u,0x80000060u,0x80000061u,0x80000062u};
    uint32_t cur = 0x78610000u;
    for(int i = 0;cur!=0;++i) {
       uint32_t idx = cur&0xFFFFu;
@@ -83,6 +83,7 @@ const char ** query_extensions() {
       "ANARI_KHR_CAMERA_ORTHOGRAPHIC",
       "ANARI_KHR_CAMERA_PERSPECTIVE",
       "ANARI_KHR_DEVICE_SYNCHRONIZATION",
+      "ANARI_KHR_FRAME_ACCUMULATION",
       "ANARI_KHR_FRAME_CHANNEL_PRIMITIVE_ID",
       "ANARI_KHR_FRAME_CHANNEL_OBJECT_ID",
       "ANARI_KHR_FRAME_CHANNEL_INSTANCE_ID",
@@ -115,16 +116,21 @@ const char ** query_object_types(ANARIDataType type) {
          static const char *ANARI_RENDERER_subtypes[] = {"default", 0};
          return ANARI_RENDERER_subtypes;
       }
-      case ANARI_INSTANCE:
-      {
-         static const char *ANARI_INSTANCE_subtypes[] = {"transform", 0};
-         return ANARI_INSTANCE_subtypes;
-      }
       case ANARI_VOLUME:
       {
          static const char *ANARI_VOLUME_subtypes[] = {"transferFunction1D", 0};
          return ANARI_VOLUME_subtypes;
       }
+      case ANARI_SPATIAL_FIELD:
+      {
+         static const char *ANARI_SPATIAL_FIELD_subtypes[] = {"structuredRegular", 0};
+         return ANARI_SPATIAL_FIELD_subtypes;
+      }
+      case ANARI_INSTANCE:
+      {
+         static const char *ANARI_INSTANCE_subtypes[] = {"transform", 0};
+         return ANARI_INSTANCE_subtypes;
+      }
       case ANARI_CAMERA:
       {
          static const char *ANARI_CAMERA_subtypes[] = {"orthographic", "perspective", 0};
@@ -145,11 +151,6 @@ const char ** query_object_types(ANARIDataType type) {
          static const char *ANARI_SAMPLER_subtypes[] = {"image1D", "image2D", "image3D", "primitive", "transform", 0};
          return ANARI_SAMPLER_subtypes;
       }
-      case ANARI_SPATIAL_FIELD:
-      {
-         static const char *ANARI_SPATIAL_FIELD_subtypes[] = {"structuredRegular", 0};
-         return ANARI_SPATIAL_FIELD_subtypes;
-      }
       default:
       {
          static const char *none_subtypes[] = {0};
@@ -205,6 +206,188 @@ static const void * ANARI_DEVICE_invalidMaterialColor_info(ANARIDataType paramTy
       default: return nullptr;
    }
 }
+static const void * ANARI_DEVICE_bvhBuildQuality_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "medium";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "Embree BVH build quality of groups and geometries committed afterwards";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"low", "medium", "high", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_DEVICE_bvhDynamic_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int8_t default_value[1] = {INT8_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "build groups committed afterwards with RTC_SCENE_FLAG_DYNAMIC";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_DEVICE_bvhCompact_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int8_t default_value[1] = {INT8_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "build groups committed afterwards with RTC_SCENE_FLAG_COMPACT";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_DEVICE_bvhRobust_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int8_t default_value[1] = {INT8_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "build groups committed afterwards with RTC_SCENE_FLAG_ROBUST";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_DEVICE_numThreads_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
+            static const int32_t default_value[1] = {INT32_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
+            static const int32_t default_value[1] = {INT32_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "number of rendering threads, 0 uses all hardware threads (defaults to HELIDE_NUM_THREADS when set); only read before the device is initialized";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_DEVICE_threadAffinity_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int8_t default_value[1] = {INT8_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "pin rendering threads to cores; only read before the device is initialized";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_DEVICE_numaFirstTouch_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int8_t default_value[1] = {INT8_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "let rendering threads first touch the buffers of frames committed afterwards, placing them on the NUMA nodes which render them";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
 static const void * ANARI_DEVICE_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
@@ -258,15 +441,29 @@ static const void * ANARI_DEVICE_statusCallbackUserData_info(ANARIDataType param
 }
 static const void * ANARI_DEVICE_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 0:
+      case 1:
          return ANARI_DEVICE_allowInvalidMaterials_info(paramType, infoName, infoType);
-      case 38:
+      case 44:
          return ANARI_DEVICE_invalidMaterialColor_info(paramType, infoName, infoType);
-      case 42:
+      case 13:
+         return ANARI_DEVICE_bvhBuildQuality_info(paramType, infoName, infoType);
+      case 15:
+         return ANARI_DEVICE_bvhDynamic_info(paramType, infoName, infoType);
+      case 14:
+         return ANARI_DEVICE_bvhCompact_info(paramType, infoName, infoType);
+      case 16:
+         return ANARI_DEVICE_bvhRobust_info(paramType, infoName, infoType);
+      case 50:
+         return ANARI_DEVICE_numThreads_info(paramType, infoName, infoType);
+      case 76:
+         return ANARI_DEVICE_threadAffinity_info(paramType, infoName, infoType);
+      case 51:
+         return ANARI_DEVICE_numaFirstTouch_info(paramType, infoName, infoType);
+      case 48:
          return ANARI_DEVICE_name_info(paramType, infoName, infoType);
-      case 61:
+      case 72:
          return ANARI_DEVICE_statusCallback_info(paramType, infoName, infoType);
-      case 62:
+      case 73:
          return ANARI_DEVICE_statusCallbackUserData_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -341,7 +538,7 @@ static const void * ANARI_RENDERER_default_eyeLightBlendRatio_info(ANARIDataType
       default: return nullptr;
    }
 }
-static const void * ANARI_RENDERER_default_taskGrainSizeWidth_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_RENDERER_default_tileSize_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -352,7 +549,7 @@ static const void * ANARI_RENDERER_default_taskGrainSizeWidth_info(ANARIDataType
          }
       case 1: // default
          if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
-            static const int32_t default_value[1] = {INT32_C(4)};
+            static const int32_t default_value[1] = {INT32_C(16)};
             return default_value;
          } else {
             return nullptr;
@@ -366,20 +563,20 @@ static const void * ANARI_RENDERER_default_taskGrainSizeWidth_info(ANARIDataType
          }
       case 3: // maximum
          if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
-            static const int32_t default_value[1] = {INT32_C(128)};
+            static const int32_t default_value[1] = {INT32_C(256)};
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "grain size of the render task along the width of the frame";
+            static const char *description = "width and height in pixels of the square tiles the frame is split into for rendering";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_RENDERER_default_taskGrainSizeHeight_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_RENDERER_default_rayPacketSize_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -390,28 +587,28 @@ static const void * ANARI_RENDERER_default_taskGrainSizeHeight_info(ANARIDataTyp
          }
       case 1: // default
          if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
-            static const int32_t default_value[1] = {INT32_C(4)};
+            static const int32_t default_value[1] = {INT32_C(0)};
             return default_value;
          } else {
             return nullptr;
          }
       case 2: // minimum
          if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
-            static const int32_t default_value[1] = {INT32_C(1)};
+            static const int32_t default_value[1] = {INT32_C(0)};
             return default_value;
          } else {
             return nullptr;
          }
       case 3: // maximum
          if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
-            static const int32_t default_value[1] = {INT32_C(128)};
+            static const int32_t default_value[1] = {INT32_C(16)};
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "grain size of the render task along the height of the frame";
+            static const char *description = "number of rays traced together as a coherent packet, 0 selects the widest packet natively supported by the CPU";
             return description;
          }
       default: return nullptr;
@@ -466,7 +663,7 @@ static const void * ANARI_RENDERER_default_ambientColor_info(ANARIDataType param
             static const char *extension = "KHR_RENDERER_AMBIENT_LIGHT";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 17;
+            static const int32_t value = 18;
             return &value;
          }
       default: return nullptr;
@@ -498,7 +695,7 @@ static const void * ANARI_RENDERER_default_ambientRadiance_info(ANARIDataType pa
             static const char *extension = "KHR_RENDERER_AMBIENT_LIGHT";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 17;
+            static const int32_t value = 18;
             return &value;
          }
       default: return nullptr;
@@ -536,7 +733,7 @@ static const void * ANARI_RENDERER_default_background_info(ANARIDataType paramTy
             static const char *extension = "KHR_RENDERER_BACKGROUND_COLOR";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 19;
             return &value;
          }
       default: return nullptr;
@@ -544,27 +741,27 @@ static const void * ANARI_RENDERER_default_background_info(ANARIDataType paramTy
 }
 static const void * ANARI_RENDERER_default_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 41:
+      case 47:
          return ANARI_RENDERER_default_mode_info(paramType, infoName, infoType);
-      case 22:
+      case 28:
          return ANARI_RENDERER_default_eyeLightBlendRatio_info(paramType, infoName, infoType);
-      case 65:
-         return ANARI_RENDERER_default_taskGrainSizeWidth_info(paramType, infoName, infoType);
-      case 64:
-         return ANARI_RENDERER_default_taskGrainSizeHeight_info(paramType, infoName, infoType);
-      case 42:
+      case 77:
+         return ANARI_RENDERER_default_tileSize_info(paramType, infoName, infoType);
+      case 67:
+         return ANARI_RENDERER_default_rayPacketSize_info(paramType, infoName, infoType);
+      case 48:
          return ANARI_RENDERER_default_name_info(paramType, infoName, infoType);
-      case 3:
-         return ANARI_RENDERER_default_ambientColor_info(paramType, infoName, infoType);
       case 4:
+         return ANARI_RENDERER_default_ambientColor_info(paramType, infoName, infoType);
+      case 5:
          return ANARI_RENDERER_default_ambientRadiance_info(paramType, infoName, infoType);
-      case 11:
+      case 12:
          return ANARI_RENDERER_default_background_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
-static const void * ANARI_INSTANCE_transform_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_VOLUME_transferFunction1D_preIntegration_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -573,23 +770,22 @@ static const void * ANARI_INSTANCE_transform_name_info(ANARIDataType paramType,
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int8_t default_value[1] = {INT8_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "pre-integrate the transfer function between samples, allowing twice larger steps without banding";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_INSTANCE_TRANSFORM";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 0;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_INSTANCE_transform_transform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_VOLUME_transferFunction1D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -598,30 +794,23 @@ static const void * ANARI_INSTANCE_transform_transform_info(ANARIDataType paramT
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
-            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "transform applied to objects in the instance";
+            static const char *description = "optional object name";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_INSTANCE_TRANSFORM";
+            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 0;
+            static const int32_t value = 1;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_INSTANCE_transform_group_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_VOLUME_transferFunction1D_value_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -632,21 +821,573 @@ static const void * ANARI_INSTANCE_transform_group_info(ANARIDataType paramType,
          }
       case 4: // description
          {
-            static const char *description = "group object being instanced";
+            static const char *description = "spatial field used for the field values of the volume";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_INSTANCE_TRANSFORM";
+            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 0;
+            static const int32_t value = 1;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_VOLUME_transferFunction1D_valueRange_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_BOX1 && infoType == ANARI_FLOAT32_BOX1) {
+            static const float default_value[2] = {0.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "sampled values of field are clamped to this range";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 1;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_VOLUME_transferFunction1D_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_true;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "sampled color";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 1;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_VOLUME_transferFunction1D_opacity_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_true;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "sampled opacity";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 1;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_VOLUME_transferFunction1D_unitDistance_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "makes volumes uniformly thinner or thicker";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 1;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_VOLUME_transferFunction1D_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "user id for objectId channel";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_FRAME_CHANNEL_OBJECT_ID";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 7;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_VOLUME_transferFunction1D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 57:
+         return ANARI_VOLUME_transferFunction1D_preIntegration_info(paramType, infoName, infoType);
+      case 48:
+         return ANARI_VOLUME_transferFunction1D_name_info(paramType, infoName, infoType);
+      case 81:
+         return ANARI_VOLUME_transferFunction1D_value_info(paramType, infoName, infoType);
+      case 82:
+         return ANARI_VOLUME_transferFunction1D_valueRange_info(paramType, infoName, infoType);
+      case 24:
+         return ANARI_VOLUME_transferFunction1D_color_info(paramType, infoName, infoType);
+      case 52:
+         return ANARI_VOLUME_transferFunction1D_opacity_info(paramType, infoName, infoType);
+      case 79:
+         return ANARI_VOLUME_transferFunction1D_unitDistance_info(paramType, infoName, infoType);
+      case 37:
+         return ANARI_VOLUME_transferFunction1D_id_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_dataLayout_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "linear";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "internal storage of the voxels, 'bricked' keeps a copy in 8^3 bricks which improves cache locality for large volumes";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"linear", "bricked", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 26;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_data_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_true;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "array of vertex centered scalar values";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT8, ANARI_INT16, ANARI_UINT16, ANARI_FLOAT32, ANARI_FLOAT64, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 26;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_origin_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "origin of the grid in object-space";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 26;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_spacing_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {1.000000f, 1.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "size of the grid cells in object-space";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 26;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_filter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "linear";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "filter mode used to interpolate the grid";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"nearest", "linear", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 26;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_INSTANCE_transform_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 26:
+         return ANARI_SPATIAL_FIELD_structuredRegular_dataLayout_info(paramType, infoName, infoType);
+      case 48:
+         return ANARI_SPATIAL_FIELD_structuredRegular_name_info(paramType, infoName, infoType);
+      case 25:
+         return ANARI_SPATIAL_FIELD_structuredRegular_data_info(paramType, infoName, infoType);
+      case 53:
+         return ANARI_SPATIAL_FIELD_structuredRegular_origin_info(paramType, infoName, infoType);
+      case 71:
+         return ANARI_SPATIAL_FIELD_structuredRegular_spacing_info(paramType, infoName, infoType);
+      case 30:
+         return ANARI_SPATIAL_FIELD_structuredRegular_filter_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_WORLD_bvhBuildQuality_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "low";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "Embree BVH build quality of the instance BVH";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"low", "medium", "high", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_WORLD_bvhDynamic_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int8_t default_value[1] = {INT8_C(1)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "build the instance BVH with RTC_SCENE_FLAG_DYNAMIC";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_WORLD_bvhCompact_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int8_t default_value[1] = {INT8_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "build the instance BVH with RTC_SCENE_FLAG_COMPACT";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_WORLD_bvhRobust_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int8_t default_value[1] = {INT8_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "build the instance BVH with RTC_SCENE_FLAG_ROBUST";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_WORLD_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_WORLD_instance_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "array of instance objects in the world";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_INSTANCE, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_WORLD_surface_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "array of non-instanced surface objects in the world";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_SURFACE, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_WORLD_volume_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -657,35 +1398,20 @@ static const void * ANARI_INSTANCE_transform_id_info(ANARIDataType paramType, in
          }
       case 4: // description
          {
-            static const char *description = "user id for instanceId channel";
+            static const char *description = "array of non-instanced volume objects in the world";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_FRAME_CHANNEL_INSTANCE_ID";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
-            return &value;
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_LIGHT, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_INSTANCE_transform_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 42:
-         return ANARI_INSTANCE_transform_name_info(paramType, infoName, infoType);
-      case 66:
-         return ANARI_INSTANCE_transform_transform_info(paramType, infoName, infoType);
-      case 29:
-         return ANARI_INSTANCE_transform_group_info(paramType, infoName, infoType);
-      case 31:
-         return ANARI_INSTANCE_transform_id_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_ARRAY1D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_WORLD_light_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -696,21 +1422,44 @@ static const void * ANARI_ARRAY1D_name_info(ANARIDataType paramType, int infoNam
          }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "array of non-instanced light objects in the world";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_LIGHT, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       default: return nullptr;
    }
 }
-static const void * ANARI_ARRAY1D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_WORLD_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 42:
-         return ANARI_ARRAY1D_name_info(paramType, infoName, infoType);
+      case 13:
+         return ANARI_WORLD_bvhBuildQuality_info(paramType, infoName, infoType);
+      case 15:
+         return ANARI_WORLD_bvhDynamic_info(paramType, infoName, infoType);
+      case 14:
+         return ANARI_WORLD_bvhCompact_info(paramType, infoName, infoType);
+      case 16:
+         return ANARI_WORLD_bvhRobust_info(paramType, infoName, infoType);
+      case 48:
+         return ANARI_WORLD_name_info(paramType, infoName, infoType);
+      case 43:
+         return ANARI_WORLD_instance_info(paramType, infoName, infoType);
+      case 74:
+         return ANARI_WORLD_surface_info(paramType, infoName, infoType);
+      case 94:
+         return ANARI_WORLD_volume_info(paramType, infoName, infoType);
+      case 45:
+         return ANARI_WORLD_light_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
-static const void * ANARI_ARRAY2D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GROUP_bvhBuildQuality_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -719,23 +1468,29 @@ static const void * ANARI_ARRAY2D_name_info(ANARIDataType paramType, int infoNam
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "medium";
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "Embree BVH build quality of the group, defaults to the device value";
             return description;
          }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"low", "medium", "high", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
       default: return nullptr;
    }
 }
-static const void * ANARI_ARRAY2D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 42:
-         return ANARI_ARRAY2D_name_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_ARRAY3D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GROUP_bvhDynamic_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -744,23 +1499,22 @@ static const void * ANARI_ARRAY3D_name_info(ANARIDataType paramType, int infoNam
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int8_t default_value[1] = {INT8_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "build the group BVH with RTC_SCENE_FLAG_DYNAMIC, defaults to the device value";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_ARRAY3D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 42:
-         return ANARI_ARRAY3D_name_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_FRAME_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GROUP_bvhCompact_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -769,83 +1523,111 @@ static const void * ANARI_FRAME_name_info(ANARIDataType paramType, int infoName,
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int8_t default_value[1] = {INT8_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "build the group BVH with RTC_SCENE_FLAG_COMPACT, defaults to the device value";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_world_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GROUP_bvhRobust_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int8_t default_value[1] = {INT8_C(0)};
+            return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "world to be rendererd";
+            static const char *description = "build the group BVH with RTC_SCENE_FLAG_ROBUST, defaults to the device value";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_renderer_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GROUP_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "renderer which renders the frame";
+            static const char *description = "optional object name";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_camera_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GROUP_surface_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "camera used to render the world";
+            static const char *description = "array of surface objects";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_SURFACE, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_size_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GROUP_volume_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "size of the frame in pixels (width, height)";
+            static const char *description = "array of volume objects";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_VOLUME, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_channel_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GROUP_light_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -856,12 +1638,12 @@ static const void * ANARI_FRAME_channel_color_info(ANARIDataType paramType, int
          }
       case 4: // description
          {
-            static const char *description = "enables mapping the color channel as the type specified";
+            static const char *description = "array of light objects";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UFIXED8_VEC4, ANARI_UFIXED8_RGBA_SRGB, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_LIGHT, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
@@ -869,7 +1651,29 @@ static const void * ANARI_FRAME_channel_color_info(ANARIDataType paramType, int
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_channel_depth_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GROUP_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 13:
+         return ANARI_GROUP_bvhBuildQuality_info(paramType, infoName, infoType);
+      case 15:
+         return ANARI_GROUP_bvhDynamic_info(paramType, infoName, infoType);
+      case 14:
+         return ANARI_GROUP_bvhCompact_info(paramType, infoName, infoType);
+      case 16:
+         return ANARI_GROUP_bvhRobust_info(paramType, infoName, infoType);
+      case 48:
+         return ANARI_GROUP_name_info(paramType, infoName, infoType);
+      case 74:
+         return ANARI_GROUP_surface_info(paramType, infoName, infoType);
+      case 94:
+         return ANARI_GROUP_volume_info(paramType, infoName, infoType);
+      case 45:
+         return ANARI_GROUP_light_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_FRAME_varianceThreshold_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -878,22 +1682,29 @@ static const void * ANARI_FRAME_channel_depth_info(ANARIDataType paramType, int
          } else {
             return nullptr;
          }
-      case 4: // description
-         {
-            static const char *description = "enables mapping the color channel as the type specified";
-            return description;
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
          }
-      case 6: // value
-         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
-            return values;
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
          } else {
             return nullptr;
          }
+      case 4: // description
+         {
+            static const char *description = "when accumulating, tiles whose average pixel variance drops below this value stop being rendered (0 disables adaptive sampling)";
+            return description;
+         }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_channel_primitiveId_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_renderRegion_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -904,28 +1715,13 @@ static const void * ANARI_FRAME_channel_primitiveId_info(ANARIDataType paramType
          }
       case 4: // description
          {
-            static const char *description = "enables mapping the primitiveId channel as the type specified";
+            static const char *description = "pixel rectangle (lower inclusive, upper exclusive) to render, other pixels are left untouched; defaults to the whole frame";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_FRAME_CHANNEL_PRIMITIVE_ID";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 5;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_channel_objectId_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_targetFrameTime_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -934,159 +1730,114 @@ static const void * ANARI_FRAME_channel_objectId_info(ANARIDataType paramType, i
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "enables mapping the objectId channel as the type specified";
+            static const char *description = "frame time budget in seconds: frames following scene or camera updates are rendered at reduced resolution and upsampled, accumulating frames adapt the tiles and samples per pixel rendered per call, and other frames coarsen volume sampling to meet it (0 disables)";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UNKNOWN};
-            return values;
+      default: return nullptr;
+   }
+}
+static const void * ANARI_FRAME_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
          } else {
             return nullptr;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_FRAME_CHANNEL_OBJECT_ID";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 6;
-            return &value;
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_channel_instanceId_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_world_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "enables mapping the instanceId channel as the type specified";
+            static const char *description = "world to be rendererd";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_FRAME_CHANNEL_INSTANCE_ID";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_frameCompletionCallback_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_renderer_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "function called on frame render completion";
+            static const char *description = "renderer which renders the frame";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_FRAME_COMPLETION_CALLBACK";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_frameCompletionCallbackUserData_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_camera_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "optional pointer passed as the first argument of the frame continuation callback";
+            static const char *description = "camera used to render the world";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_FRAME_COMPLETION_CALLBACK";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 42:
-         return ANARI_FRAME_name_info(paramType, infoName, infoType);
-      case 82:
-         return ANARI_FRAME_world_info(paramType, infoName, infoType);
-      case 58:
-         return ANARI_FRAME_renderer_info(paramType, infoName, infoType);
-      case 12:
-         return ANARI_FRAME_camera_info(paramType, infoName, infoType);
-      case 59:
-         return ANARI_FRAME_size_info(paramType, infoName, infoType);
-      case 14:
-         return ANARI_FRAME_channel_color_info(paramType, infoName, infoType);
-      case 15:
-         return ANARI_FRAME_channel_depth_info(paramType, infoName, infoType);
-      case 18:
-         return ANARI_FRAME_channel_primitiveId_info(paramType, infoName, infoType);
-      case 17:
-         return ANARI_FRAME_channel_objectId_info(paramType, infoName, infoType);
-      case 16:
-         return ANARI_FRAME_channel_instanceId_info(paramType, infoName, infoType);
-      case 26:
-         return ANARI_FRAME_frameCompletionCallback_info(paramType, infoName, infoType);
-      case 27:
-         return ANARI_FRAME_frameCompletionCallbackUserData_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_GROUP_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_size_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "size of the frame in pixels (width, height)";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GROUP_surface_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_channel_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1097,12 +1848,12 @@ static const void * ANARI_GROUP_surface_info(ANARIDataType paramType, int infoNa
          }
       case 4: // description
          {
-            static const char *description = "array of surface objects";
+            static const char *description = "enables mapping the color channel as the type specified";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_SURFACE, ANARI_UNKNOWN};
+      case 6: // value
+         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8_VEC4, ANARI_UFIXED8_RGBA_SRGB, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
@@ -1110,7 +1861,7 @@ static const void * ANARI_GROUP_surface_info(ANARIDataType paramType, int infoNa
       default: return nullptr;
    }
 }
-static const void * ANARI_GROUP_volume_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_channel_depth_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1121,12 +1872,12 @@ static const void * ANARI_GROUP_volume_info(ANARIDataType paramType, int infoNam
          }
       case 4: // description
          {
-            static const char *description = "array of volume objects";
+            static const char *description = "enables mapping the color channel as the type specified";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_VOLUME, ANARI_UNKNOWN};
+      case 6: // value
+         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
@@ -1134,7 +1885,7 @@ static const void * ANARI_GROUP_volume_info(ANARIDataType paramType, int infoNam
       default: return nullptr;
    }
 }
-static const void * ANARI_GROUP_light_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_accumulation_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1145,34 +1896,21 @@ static const void * ANARI_GROUP_light_info(ANARIDataType paramType, int infoName
          }
       case 4: // description
          {
-            static const char *description = "array of light objects";
+            static const char *description = "enable device internal buffers for frame accumulation";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_LIGHT, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_FRAME_ACCUMULATION";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 5;
+            return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GROUP_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 42:
-         return ANARI_GROUP_name_info(paramType, infoName, infoType);
-      case 63:
-         return ANARI_GROUP_surface_info(paramType, infoName, infoType);
-      case 81:
-         return ANARI_GROUP_volume_info(paramType, infoName, infoType);
-      case 39:
-         return ANARI_GROUP_light_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_WORLD_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_channel_primitiveId_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1183,13 +1921,28 @@ static const void * ANARI_WORLD_name_info(ANARIDataType paramType, int infoName,
          }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "enables mapping the primitiveId channel as the type specified";
             return description;
          }
+      case 6: // value
+         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_FRAME_CHANNEL_PRIMITIVE_ID";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 6;
+            return &value;
+         }
       default: return nullptr;
    }
 }
-static const void * ANARI_WORLD_instance_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_channel_objectId_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1200,20 +1953,28 @@ static const void * ANARI_WORLD_instance_info(ANARIDataType paramType, int infoN
          }
       case 4: // description
          {
-            static const char *description = "array of instance objects in the world";
+            static const char *description = "enables mapping the objectId channel as the type specified";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_INSTANCE, ANARI_UNKNOWN};
+      case 6: // value
+         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_FRAME_CHANNEL_OBJECT_ID";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 7;
+            return &value;
+         }
       default: return nullptr;
    }
 }
-static const void * ANARI_WORLD_surface_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_channel_instanceId_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1224,20 +1985,28 @@ static const void * ANARI_WORLD_surface_info(ANARIDataType paramType, int infoNa
          }
       case 4: // description
          {
-            static const char *description = "array of non-instanced surface objects in the world";
+            static const char *description = "enables mapping the instanceId channel as the type specified";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_SURFACE, ANARI_UNKNOWN};
+      case 6: // value
+         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_FRAME_CHANNEL_INSTANCE_ID";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 8;
+            return &value;
+         }
       default: return nullptr;
    }
 }
-static const void * ANARI_WORLD_volume_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_frameCompletionCallback_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1248,20 +2017,21 @@ static const void * ANARI_WORLD_volume_info(ANARIDataType paramType, int infoNam
          }
       case 4: // description
          {
-            static const char *description = "array of non-instanced volume objects in the world";
+            static const char *description = "function called on frame render completion";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_LIGHT, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_FRAME_COMPLETION_CALLBACK";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 9;
+            return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_WORLD_light_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_frameCompletionCallbackUserData_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1272,36 +2042,59 @@ static const void * ANARI_WORLD_light_info(ANARIDataType paramType, int infoName
          }
       case 4: // description
          {
-            static const char *description = "array of non-instanced light objects in the world";
+            static const char *description = "optional pointer passed as the first argument of the frame continuation callback";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_LIGHT, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_FRAME_COMPLETION_CALLBACK";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 9;
+            return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_WORLD_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 42:
-         return ANARI_WORLD_name_info(paramType, infoName, infoType);
-      case 37:
-         return ANARI_WORLD_instance_info(paramType, infoName, infoType);
-      case 63:
-         return ANARI_WORLD_surface_info(paramType, infoName, infoType);
-      case 81:
-         return ANARI_WORLD_volume_info(paramType, infoName, infoType);
-      case 39:
-         return ANARI_WORLD_light_info(paramType, infoName, infoType);
+      case 83:
+         return ANARI_FRAME_varianceThreshold_info(paramType, infoName, infoType);
+      case 68:
+         return ANARI_FRAME_renderRegion_info(paramType, infoName, infoType);
+      case 75:
+         return ANARI_FRAME_targetFrameTime_info(paramType, infoName, infoType);
+      case 48:
+         return ANARI_FRAME_name_info(paramType, infoName, infoType);
+      case 95:
+         return ANARI_FRAME_world_info(paramType, infoName, infoType);
+      case 69:
+         return ANARI_FRAME_renderer_info(paramType, infoName, infoType);
+      case 17:
+         return ANARI_FRAME_camera_info(paramType, infoName, infoType);
+      case 70:
+         return ANARI_FRAME_size_info(paramType, infoName, infoType);
+      case 19:
+         return ANARI_FRAME_channel_color_info(paramType, infoName, infoType);
+      case 20:
+         return ANARI_FRAME_channel_depth_info(paramType, infoName, infoType);
+      case 0:
+         return ANARI_FRAME_accumulation_info(paramType, infoName, infoType);
+      case 23:
+         return ANARI_FRAME_channel_primitiveId_info(paramType, infoName, infoType);
+      case 22:
+         return ANARI_FRAME_channel_objectId_info(paramType, infoName, infoType);
+      case 21:
+         return ANARI_FRAME_channel_instanceId_info(paramType, infoName, infoType);
+      case 32:
+         return ANARI_FRAME_frameCompletionCallback_info(paramType, infoName, infoType);
+      case 33:
+         return ANARI_FRAME_frameCompletionCallbackUserData_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
-static const void * ANARI_SURFACE_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_INSTANCE_transform_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1315,27 +2108,50 @@ static const void * ANARI_SURFACE_name_info(ANARIDataType paramType, int infoNam
             static const char *description = "optional object name";
             return description;
          }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_INSTANCE_TRANSFORM";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 0;
+            return &value;
+         }
       default: return nullptr;
    }
 }
-static const void * ANARI_SURFACE_geometry_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_INSTANCE_transform_transform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
+            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
+            return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "geometry object defining the surface geometry";
+            static const char *description = "transform applied to objects in the instance";
             return description;
          }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_INSTANCE_TRANSFORM";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 0;
+            return &value;
+         }
       default: return nullptr;
    }
 }
-static const void * ANARI_SURFACE_material_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_INSTANCE_transform_group_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1346,13 +2162,21 @@ static const void * ANARI_SURFACE_material_info(ANARIDataType paramType, int inf
          }
       case 4: // description
          {
-            static const char *description = "material object defining the surface appearance";
+            static const char *description = "group object being instanced";
             return description;
          }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_INSTANCE_TRANSFORM";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 0;
+            return &value;
+         }
       default: return nullptr;
    }
 }
-static const void * ANARI_SURFACE_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_INSTANCE_transform_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1363,35 +2187,35 @@ static const void * ANARI_SURFACE_id_info(ANARIDataType paramType, int infoName,
          }
       case 4: // description
          {
-            static const char *description = "user id for objectId channel";
+            static const char *description = "user id for instanceId channel";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_FRAME_CHANNEL_OBJECT_ID";
+            static const char *extension = "KHR_FRAME_CHANNEL_INSTANCE_ID";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 6;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SURFACE_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_INSTANCE_transform_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 42:
-         return ANARI_SURFACE_name_info(paramType, infoName, infoType);
-      case 28:
-         return ANARI_SURFACE_geometry_info(paramType, infoName, infoType);
-      case 40:
-         return ANARI_SURFACE_material_info(paramType, infoName, infoType);
-      case 31:
-         return ANARI_SURFACE_id_info(paramType, infoName, infoType);
+      case 48:
+         return ANARI_INSTANCE_transform_name_info(paramType, infoName, infoType);
+      case 78:
+         return ANARI_INSTANCE_transform_transform_info(paramType, infoName, infoType);
+      case 35:
+         return ANARI_INSTANCE_transform_group_info(paramType, infoName, infoType);
+      case 37:
+         return ANARI_INSTANCE_transform_id_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
-static const void * ANARI_VOLUME_transferFunction1D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_ARRAY1D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1405,43 +2229,43 @@ static const void * ANARI_VOLUME_transferFunction1D_name_info(ANARIDataType para
             static const char *description = "optional object name";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_VOLUME_transferFunction1D_value_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_ARRAY1D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 48:
+         return ANARI_ARRAY1D_name_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_ARRAY2D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "spatial field used for the field values of the volume";
+            static const char *description = "optional object name";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_VOLUME_transferFunction1D_valueRange_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_ARRAY2D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 48:
+         return ANARI_ARRAY2D_name_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_ARRAY3D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1450,62 +2274,40 @@ static const void * ANARI_VOLUME_transferFunction1D_valueRange_info(ANARIDataTyp
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_BOX1 && infoType == ANARI_FLOAT32_BOX1) {
-            static const float default_value[2] = {0.000000f, 1.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "sampled values of field are clamped to this range";
+            static const char *description = "optional object name";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_VOLUME_transferFunction1D_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_ARRAY3D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 48:
+         return ANARI_ARRAY3D_name_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_SURFACE_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "sampled color";
+            static const char *description = "optional object name";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_VOLUME_transferFunction1D_opacity_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SURFACE_geometry_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1516,60 +2318,30 @@ static const void * ANARI_VOLUME_transferFunction1D_opacity_info(ANARIDataType p
          }
       case 4: // description
          {
-            static const char *description = "sampled opacity";
+            static const char *description = "geometry object defining the surface geometry";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_VOLUME_transferFunction1D_unitDistance_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SURFACE_material_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
-         } else {
-            return nullptr;
-         }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
-            static const float default_value[1] = {1.000000f};
-            return default_value;
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "makes volumes uniformly thinner or thicker";
+            static const char *description = "material object defining the surface appearance";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_VOLUME_transferFunction1D_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SURFACE_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1588,28 +2360,22 @@ static const void * ANARI_VOLUME_transferFunction1D_id_info(ANARIDataType paramT
             static const char *extension = "KHR_FRAME_CHANNEL_OBJECT_ID";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 6;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_VOLUME_transferFunction1D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SURFACE_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 42:
-         return ANARI_VOLUME_transferFunction1D_name_info(paramType, infoName, infoType);
-      case 69:
-         return ANARI_VOLUME_transferFunction1D_value_info(paramType, infoName, infoType);
-      case 70:
-         return ANARI_VOLUME_transferFunction1D_valueRange_info(paramType, infoName, infoType);
-      case 19:
-         return ANARI_VOLUME_transferFunction1D_color_info(paramType, infoName, infoType);
-      case 44:
-         return ANARI_VOLUME_transferFunction1D_opacity_info(paramType, infoName, infoType);
-      case 67:
-         return ANARI_VOLUME_transferFunction1D_unitDistance_info(paramType, infoName, infoType);
-      case 31:
-         return ANARI_VOLUME_transferFunction1D_id_info(paramType, infoName, infoType);
+      case 48:
+         return ANARI_SURFACE_name_info(paramType, infoName, infoType);
+      case 34:
+         return ANARI_SURFACE_geometry_info(paramType, infoName, infoType);
+      case 46:
+         return ANARI_SURFACE_material_info(paramType, infoName, infoType);
+      case 37:
+         return ANARI_SURFACE_id_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
@@ -1901,23 +2667,23 @@ static const void * ANARI_CAMERA_orthographic_far_info(ANARIDataType paramType,
 }
 static const void * ANARI_CAMERA_orthographic_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 42:
-         return ANARI_CAMERA_orthographic_name_info(paramType, infoName, infoType);
       case 48:
+         return ANARI_CAMERA_orthographic_name_info(paramType, infoName, infoType);
+      case 56:
          return ANARI_CAMERA_orthographic_position_info(paramType, infoName, infoType);
-      case 21:
+      case 27:
          return ANARI_CAMERA_orthographic_direction_info(paramType, infoName, infoType);
-      case 68:
+      case 80:
          return ANARI_CAMERA_orthographic_up_info(paramType, infoName, infoType);
-      case 33:
+      case 39:
          return ANARI_CAMERA_orthographic_imageRegion_info(paramType, infoName, infoType);
-      case 6:
+      case 7:
          return ANARI_CAMERA_orthographic_aspect_info(paramType, infoName, infoType);
-      case 30:
+      case 36:
          return ANARI_CAMERA_orthographic_height_info(paramType, infoName, infoType);
-      case 43:
+      case 49:
          return ANARI_CAMERA_orthographic_near_info(paramType, infoName, infoType);
-      case 23:
+      case 29:
          return ANARI_CAMERA_orthographic_far_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -2210,23 +2976,23 @@ static const void * ANARI_CAMERA_perspective_far_info(ANARIDataType paramType, i
 }
 static const void * ANARI_CAMERA_perspective_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 42:
-         return ANARI_CAMERA_perspective_name_info(paramType, infoName, infoType);
       case 48:
+         return ANARI_CAMERA_perspective_name_info(paramType, infoName, infoType);
+      case 56:
          return ANARI_CAMERA_perspective_position_info(paramType, infoName, infoType);
-      case 21:
+      case 27:
          return ANARI_CAMERA_perspective_direction_info(paramType, infoName, infoType);
-      case 68:
+      case 80:
          return ANARI_CAMERA_perspective_up_info(paramType, infoName, infoType);
-      case 33:
+      case 39:
          return ANARI_CAMERA_perspective_imageRegion_info(paramType, infoName, infoType);
-      case 25:
+      case 31:
          return ANARI_CAMERA_perspective_fovy_info(paramType, infoName, infoType);
-      case 6:
+      case 7:
          return ANARI_CAMERA_perspective_aspect_info(paramType, infoName, infoType);
-      case 43:
+      case 49:
          return ANARI_CAMERA_perspective_near_info(paramType, infoName, infoType);
-      case 23:
+      case 29:
          return ANARI_CAMERA_perspective_far_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -2251,7 +3017,7 @@ static const void * ANARI_GEOMETRY_cone_name_info(ANARIDataType paramType, int i
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -2276,7 +3042,7 @@ static const void * ANARI_GEOMETRY_cone_color_info(ANARIDataType paramType, int
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -2301,7 +3067,7 @@ static const void * ANARI_GEOMETRY_cone_attribute0_info(ANARIDataType paramType,
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -2326,7 +3092,7 @@ static const void * ANARI_GEOMETRY_cone_attribute1_info(ANARIDataType paramType,
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -2351,7 +3117,7 @@ static const void * ANARI_GEOMETRY_cone_attribute2_info(ANARIDataType paramType,
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -2376,7 +3142,7 @@ static const void * ANARI_GEOMETRY_cone_attribute3_info(ANARIDataType paramType,
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -2408,7 +3174,7 @@ static const void * ANARI_GEOMETRY_cone_primitive_color_info(ANARIDataType param
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -2440,7 +3206,7 @@ static const void * ANARI_GEOMETRY_cone_primitive_attribute0_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -2472,7 +3238,7 @@ static const void * ANARI_GEOMETRY_cone_primitive_attribute1_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -2504,7 +3270,7 @@ static const void * ANARI_GEOMETRY_cone_primitive_attribute2_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -2536,7 +3302,7 @@ static const void * ANARI_GEOMETRY_cone_primitive_attribute3_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -2568,7 +3334,7 @@ static const void * ANARI_GEOMETRY_cone_primitive_id_info(ANARIDataType paramTyp
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -2600,7 +3366,7 @@ static const void * ANARI_GEOMETRY_cone_vertex_position_info(ANARIDataType param
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -2632,7 +3398,7 @@ static const void * ANARI_GEOMETRY_cone_vertex_radius_info(ANARIDataType paramTy
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -2664,7 +3430,7 @@ static const void * ANARI_GEOMETRY_cone_vertex_cap_info(ANARIDataType paramType,
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -2696,7 +3462,7 @@ static const void * ANARI_GEOMETRY_cone_vertex_color_info(ANARIDataType paramTyp
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -2728,7 +3494,7 @@ static const void * ANARI_GEOMETRY_cone_vertex_attribute0_info(ANARIDataType par
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -2760,7 +3526,7 @@ static const void * ANARI_GEOMETRY_cone_vertex_attribute1_info(ANARIDataType par
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -2792,7 +3558,7 @@ static const void * ANARI_GEOMETRY_cone_vertex_attribute2_info(ANARIDataType par
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -2824,7 +3590,7 @@ static const void * ANARI_GEOMETRY_cone_vertex_attribute3_info(ANARIDataType par
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -2856,7 +3622,7 @@ static const void * ANARI_GEOMETRY_cone_primitive_index_info(ANARIDataType param
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -2895,7 +3661,7 @@ static const void * ANARI_GEOMETRY_cone_caps_info(ANARIDataType paramType, int i
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -2903,49 +3669,49 @@ static const void * ANARI_GEOMETRY_cone_caps_info(ANARIDataType paramType, int i
 }
 static const void * ANARI_GEOMETRY_cone_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 42:
+      case 48:
          return ANARI_GEOMETRY_cone_name_info(paramType, infoName, infoType);
-      case 19:
+      case 24:
          return ANARI_GEOMETRY_cone_color_info(paramType, infoName, infoType);
-      case 7:
-         return ANARI_GEOMETRY_cone_attribute0_info(paramType, infoName, infoType);
       case 8:
-         return ANARI_GEOMETRY_cone_attribute1_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_cone_attribute0_info(paramType, infoName, infoType);
       case 9:
-         return ANARI_GEOMETRY_cone_attribute2_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_cone_attribute1_info(paramType, infoName, infoType);
       case 10:
+         return ANARI_GEOMETRY_cone_attribute2_info(paramType, infoName, infoType);
+      case 11:
          return ANARI_GEOMETRY_cone_attribute3_info(paramType, infoName, infoType);
-      case 53:
+      case 62:
          return ANARI_GEOMETRY_cone_primitive_color_info(paramType, infoName, infoType);
-      case 49:
+      case 58:
          return ANARI_GEOMETRY_cone_primitive_attribute0_info(paramType, infoName, infoType);
-      case 50:
+      case 59:
          return ANARI_GEOMETRY_cone_primitive_attribute1_info(paramType, infoName, infoType);
-      case 51:
+      case 60:
          return ANARI_GEOMETRY_cone_primitive_attribute2_info(paramType, infoName, infoType);
-      case 52:
+      case 61:
          return ANARI_GEOMETRY_cone_primitive_attribute3_info(paramType, infoName, infoType);
-      case 54:
+      case 63:
          return ANARI_GEOMETRY_cone_primitive_id_info(paramType, infoName, infoType);
-      case 78:
+      case 91:
          return ANARI_GEOMETRY_cone_vertex_position_info(paramType, infoName, infoType);
-      case 79:
+      case 92:
          return ANARI_GEOMETRY_cone_vertex_radius_info(paramType, infoName, infoType);
-      case 75:
+      case 88:
          return ANARI_GEOMETRY_cone_vertex_cap_info(paramType, infoName, infoType);
-      case 76:
+      case 89:
          return ANARI_GEOMETRY_cone_vertex_color_info(paramType, infoName, infoType);
-      case 71:
+      case 84:
          return ANARI_GEOMETRY_cone_vertex_attribute0_info(paramType, infoName, infoType);
-      case 72:
+      case 85:
          return ANARI_GEOMETRY_cone_vertex_attribute1_info(paramType, infoName, infoType);
-      case 73:
+      case 86:
          return ANARI_GEOMETRY_cone_vertex_attribute2_info(paramType, infoName, infoType);
-      case 74:
+      case 87:
          return ANARI_GEOMETRY_cone_vertex_attribute3_info(paramType, infoName, infoType);
-      case 55:
+      case 64:
          return ANARI_GEOMETRY_cone_primitive_index_info(paramType, infoName, infoType);
-      case 13:
+      case 18:
          return ANARI_GEOMETRY_cone_caps_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -2970,7 +3736,7 @@ static const void * ANARI_GEOMETRY_curve_name_info(ANARIDataType paramType, int
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -2995,7 +3761,7 @@ static const void * ANARI_GEOMETRY_curve_color_info(ANARIDataType paramType, int
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3020,7 +3786,7 @@ static const void * ANARI_GEOMETRY_curve_attribute0_info(ANARIDataType paramType
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3045,7 +3811,7 @@ static const void * ANARI_GEOMETRY_curve_attribute1_info(ANARIDataType paramType
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3070,7 +3836,7 @@ static const void * ANARI_GEOMETRY_curve_attribute2_info(ANARIDataType paramType
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3095,7 +3861,7 @@ static const void * ANARI_GEOMETRY_curve_attribute3_info(ANARIDataType paramType
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3127,7 +3893,7 @@ static const void * ANARI_GEOMETRY_curve_primitive_color_info(ANARIDataType para
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3159,7 +3925,7 @@ static const void * ANARI_GEOMETRY_curve_primitive_attribute0_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3191,7 +3957,7 @@ static const void * ANARI_GEOMETRY_curve_primitive_attribute1_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3223,7 +3989,7 @@ static const void * ANARI_GEOMETRY_curve_primitive_attribute2_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3255,7 +4021,7 @@ static const void * ANARI_GEOMETRY_curve_primitive_attribute3_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3287,7 +4053,7 @@ static const void * ANARI_GEOMETRY_curve_primitive_id_info(ANARIDataType paramTy
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3319,7 +4085,7 @@ static const void * ANARI_GEOMETRY_curve_vertex_position_info(ANARIDataType para
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3351,7 +4117,7 @@ static const void * ANARI_GEOMETRY_curve_vertex_radius_info(ANARIDataType paramT
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3383,7 +4149,7 @@ static const void * ANARI_GEOMETRY_curve_vertex_color_info(ANARIDataType paramTy
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3415,7 +4181,7 @@ static const void * ANARI_GEOMETRY_curve_vertex_attribute0_info(ANARIDataType pa
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3447,7 +4213,7 @@ static const void * ANARI_GEOMETRY_curve_vertex_attribute1_info(ANARIDataType pa
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3479,7 +4245,7 @@ static const void * ANARI_GEOMETRY_curve_vertex_attribute2_info(ANARIDataType pa
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3511,7 +4277,7 @@ static const void * ANARI_GEOMETRY_curve_vertex_attribute3_info(ANARIDataType pa
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3543,7 +4309,7 @@ static const void * ANARI_GEOMETRY_curve_primitive_index_info(ANARIDataType para
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3568,7 +4334,7 @@ static const void * ANARI_GEOMETRY_curve_radius_info(ANARIDataType paramType, in
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3576,47 +4342,47 @@ static const void * ANARI_GEOMETRY_curve_radius_info(ANARIDataType paramType, in
 }
 static const void * ANARI_GEOMETRY_curve_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 42:
+      case 48:
          return ANARI_GEOMETRY_curve_name_info(paramType, infoName, infoType);
-      case 19:
+      case 24:
          return ANARI_GEOMETRY_curve_color_info(paramType, infoName, infoType);
-      case 7:
-         return ANARI_GEOMETRY_curve_attribute0_info(paramType, infoName, infoType);
       case 8:
-         return ANARI_GEOMETRY_curve_attribute1_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_curve_attribute0_info(paramType, infoName, infoType);
       case 9:
-         return ANARI_GEOMETRY_curve_attribute2_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_curve_attribute1_info(paramType, infoName, infoType);
       case 10:
+         return ANARI_GEOMETRY_curve_attribute2_info(paramType, infoName, infoType);
+      case 11:
          return ANARI_GEOMETRY_curve_attribute3_info(paramType, infoName, infoType);
-      case 53:
+      case 62:
          return ANARI_GEOMETRY_curve_primitive_color_info(paramType, infoName, infoType);
-      case 49:
+      case 58:
          return ANARI_GEOMETRY_curve_primitive_attribute0_info(paramType, infoName, infoType);
-      case 50:
+      case 59:
          return ANARI_GEOMETRY_curve_primitive_attribute1_info(paramType, infoName, infoType);
-      case 51:
+      case 60:
          return ANARI_GEOMETRY_curve_primitive_attribute2_info(paramType, infoName, infoType);
-      case 52:
+      case 61:
          return ANARI_GEOMETRY_curve_primitive_attribute3_info(paramType, infoName, infoType);
-      case 54:
+      case 63:
          return ANARI_GEOMETRY_curve_primitive_id_info(paramType, infoName, infoType);
-      case 78:
+      case 91:
          return ANARI_GEOMETRY_curve_vertex_position_info(paramType, infoName, infoType);
-      case 79:
+      case 92:
          return ANARI_GEOMETRY_curve_vertex_radius_info(paramType, infoName, infoType);
-      case 76:
+      case 89:
          return ANARI_GEOMETRY_curve_vertex_color_info(paramType, infoName, infoType);
-      case 71:
+      case 84:
          return ANARI_GEOMETRY_curve_vertex_attribute0_info(paramType, infoName, infoType);
-      case 72:
+      case 85:
          return ANARI_GEOMETRY_curve_vertex_attribute1_info(paramType, infoName, infoType);
-      case 73:
+      case 86:
          return ANARI_GEOMETRY_curve_vertex_attribute2_info(paramType, infoName, infoType);
-      case 74:
+      case 87:
          return ANARI_GEOMETRY_curve_vertex_attribute3_info(paramType, infoName, infoType);
-      case 55:
+      case 64:
          return ANARI_GEOMETRY_curve_primitive_index_info(paramType, infoName, infoType);
-      case 57:
+      case 66:
          return ANARI_GEOMETRY_curve_radius_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -3641,7 +4407,7 @@ static const void * ANARI_GEOMETRY_cylinder_name_info(ANARIDataType paramType, i
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -3666,7 +4432,7 @@ static const void * ANARI_GEOMETRY_cylinder_color_info(ANARIDataType paramType,
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -3691,7 +4457,7 @@ static const void * ANARI_GEOMETRY_cylinder_attribute0_info(ANARIDataType paramT
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -3716,7 +4482,7 @@ static const void * ANARI_GEOMETRY_cylinder_attribute1_info(ANARIDataType paramT
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -3741,7 +4507,7 @@ static const void * ANARI_GEOMETRY_cylinder_attribute2_info(ANARIDataType paramT
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -3766,7 +4532,7 @@ static const void * ANARI_GEOMETRY_cylinder_attribute3_info(ANARIDataType paramT
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -3798,7 +4564,7 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_color_info(ANARIDataType p
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -3830,7 +4596,7 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_attribute0_info(ANARIDataT
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -3862,7 +4628,7 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_attribute1_info(ANARIDataT
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -3894,7 +4660,7 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_attribute2_info(ANARIDataT
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -3926,7 +4692,7 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_attribute3_info(ANARIDataT
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -3958,7 +4724,7 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_id_info(ANARIDataType para
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -3990,7 +4756,7 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_position_info(ANARIDataType p
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -4022,7 +4788,7 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_cap_info(ANARIDataType paramT
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -4054,7 +4820,7 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_color_info(ANARIDataType para
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -4086,7 +4852,7 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_attribute0_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -4118,7 +4884,7 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_attribute1_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -4150,7 +4916,7 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_attribute2_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -4182,7 +4948,7 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_attribute3_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -4214,7 +4980,7 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_index_info(ANARIDataType p
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -4246,7 +5012,7 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_radius_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -4271,7 +5037,7 @@ static const void * ANARI_GEOMETRY_cylinder_radius_info(ANARIDataType paramType,
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -4310,7 +5076,7 @@ static const void * ANARI_GEOMETRY_cylinder_caps_info(ANARIDataType paramType, i
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -4318,51 +5084,51 @@ static const void * ANARI_GEOMETRY_cylinder_caps_info(ANARIDataType paramType, i
 }
 static const void * ANARI_GEOMETRY_cylinder_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 42:
+      case 48:
          return ANARI_GEOMETRY_cylinder_name_info(paramType, infoName, infoType);
-      case 19:
+      case 24:
          return ANARI_GEOMETRY_cylinder_color_info(paramType, infoName, infoType);
-      case 7:
-         return ANARI_GEOMETRY_cylinder_attribute0_info(paramType, infoName, infoType);
       case 8:
-         return ANARI_GEOMETRY_cylinder_attribute1_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_cylinder_attribute0_info(paramType, infoName, infoType);
       case 9:
-         return ANARI_GEOMETRY_cylinder_attribute2_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_cylinder_attribute1_info(paramType, infoName, infoType);
       case 10:
+         return ANARI_GEOMETRY_cylinder_attribute2_info(paramType, infoName, infoType);
+      case 11:
          return ANARI_GEOMETRY_cylinder_attribute3_info(paramType, infoName, infoType);
-      case 53:
+      case 62:
          return ANARI_GEOMETRY_cylinder_primitive_color_info(paramType, infoName, infoType);
-      case 49:
+      case 58:
          return ANARI_GEOMETRY_cylinder_primitive_attribute0_info(paramType, infoName, infoType);
-      case 50:
+      case 59:
          return ANARI_GEOMETRY_cylinder_primitive_attribute1_info(paramType, infoName, infoType);
-      case 51:
+      case 60:
          return ANARI_GEOMETRY_cylinder_primitive_attribute2_info(paramType, infoName, infoType);
-      case 52:
+      case 61:
          return ANARI_GEOMETRY_cylinder_primitive_attribute3_info(paramType, infoName, infoType);
-      case 54:
+      case 63:
          return ANARI_GEOMETRY_cylinder_primitive_id_info(paramType, infoName, infoType);
-      case 78:
+      case 91:
          return ANARI_GEOMETRY_cylinder_vertex_position_info(paramType, infoName, infoType);
-      case 75:
+      case 88:
          return ANARI_GEOMETRY_cylinder_vertex_cap_info(paramType, infoName, infoType);
-      case 76:
+      case 89:
          return ANARI_GEOMETRY_cylinder_vertex_color_info(paramType, infoName, infoType);
-      case 71:
+      case 84:
          return ANARI_GEOMETRY_cylinder_vertex_attribute0_info(paramType, infoName, infoType);
-      case 72:
+      case 85:
          return ANARI_GEOMETRY_cylinder_vertex_attribute1_info(paramType, infoName, infoType);
-      case 73:
+      case 86:
          return ANARI_GEOMETRY_cylinder_vertex_attribute2_info(paramType, infoName, infoType);
-      case 74:
+      case 87:
          return ANARI_GEOMETRY_cylinder_vertex_attribute3_info(paramType, infoName, infoType);
-      case 55:
+      case 64:
          return ANARI_GEOMETRY_cylinder_primitive_index_info(paramType, infoName, infoType);
-      case 56:
+      case 65:
          return ANARI_GEOMETRY_cylinder_primitive_radius_info(paramType, infoName, infoType);
-      case 57:
+      case 66:
          return ANARI_GEOMETRY_cylinder_radius_info(paramType, infoName, infoType);
-      case 13:
+      case 18:
          return ANARI_GEOMETRY_cylinder_caps_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -4387,7 +5153,7 @@ static const void * ANARI_GEOMETRY_quad_name_info(ANARIDataType paramType, int i
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4412,7 +5178,7 @@ static const void * ANARI_GEOMETRY_quad_color_info(ANARIDataType paramType, int
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4437,7 +5203,7 @@ static const void * ANARI_GEOMETRY_quad_attribute0_info(ANARIDataType paramType,
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4462,7 +5228,7 @@ static const void * ANARI_GEOMETRY_quad_attribute1_info(ANARIDataType paramType,
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4487,7 +5253,7 @@ static const void * ANARI_GEOMETRY_quad_attribute2_info(ANARIDataType paramType,
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4512,7 +5278,7 @@ static const void * ANARI_GEOMETRY_quad_attribute3_info(ANARIDataType paramType,
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4544,7 +5310,7 @@ static const void * ANARI_GEOMETRY_quad_primitive_color_info(ANARIDataType param
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4576,7 +5342,7 @@ static const void * ANARI_GEOMETRY_quad_primitive_attribute0_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4608,7 +5374,7 @@ static const void * ANARI_GEOMETRY_quad_primitive_attribute1_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4640,7 +5406,7 @@ static const void * ANARI_GEOMETRY_quad_primitive_attribute2_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4672,7 +5438,7 @@ static const void * ANARI_GEOMETRY_quad_primitive_attribute3_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4704,7 +5470,7 @@ static const void * ANARI_GEOMETRY_quad_primitive_id_info(ANARIDataType paramTyp
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4736,7 +5502,7 @@ static const void * ANARI_GEOMETRY_quad_vertex_position_info(ANARIDataType param
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4768,7 +5534,7 @@ static const void * ANARI_GEOMETRY_quad_vertex_normal_info(ANARIDataType paramTy
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4800,7 +5566,7 @@ static const void * ANARI_GEOMETRY_quad_vertex_tangent_info(ANARIDataType paramT
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4832,7 +5598,7 @@ static const void * ANARI_GEOMETRY_quad_vertex_color_info(ANARIDataType paramTyp
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4864,7 +5630,7 @@ static const void * ANARI_GEOMETRY_quad_vertex_attribute0_info(ANARIDataType par
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4896,7 +5662,7 @@ static const void * ANARI_GEOMETRY_quad_vertex_attribute1_info(ANARIDataType par
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4928,7 +5694,7 @@ static const void * ANARI_GEOMETRY_quad_vertex_attribute2_info(ANARIDataType par
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4960,7 +5726,7 @@ static const void * ANARI_GEOMETRY_quad_vertex_attribute3_info(ANARIDataType par
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4992,7 +5758,7 @@ static const void * ANARI_GEOMETRY_quad_primitive_index_info(ANARIDataType param
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -5000,47 +5766,47 @@ static const void * ANARI_GEOMETRY_quad_primitive_index_info(ANARIDataType param
 }
 static const void * ANARI_GEOMETRY_quad_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 42:
+      case 48:
          return ANARI_GEOMETRY_quad_name_info(paramType, infoName, infoType);
-      case 19:
+      case 24:
          return ANARI_GEOMETRY_quad_color_info(paramType, infoName, infoType);
-      case 7:
-         return ANARI_GEOMETRY_quad_attribute0_info(paramType, infoName, infoType);
       case 8:
-         return ANARI_GEOMETRY_quad_attribute1_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_quad_attribute0_info(paramType, infoName, infoType);
       case 9:
-         return ANARI_GEOMETRY_quad_attribute2_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_quad_attribute1_info(paramType, infoName, infoType);
       case 10:
+         return ANARI_GEOMETRY_quad_attribute2_info(paramType, infoName, infoType);
+      case 11:
          return ANARI_GEOMETRY_quad_attribute3_info(paramType, infoName, infoType);
-      case 53:
+      case 62:
          return ANARI_GEOMETRY_quad_primitive_color_info(paramType, infoName, infoType);
-      case 49:
+      case 58:
          return ANARI_GEOMETRY_quad_primitive_attribute0_info(paramType, infoName, infoType);
-      case 50:
+      case 59:
          return ANARI_GEOMETRY_quad_primitive_attribute1_info(paramType, infoName, infoType);
-      case 51:
+      case 60:
          return ANARI_GEOMETRY_quad_primitive_attribute2_info(paramType, infoName, infoType);
-      case 52:
+      case 61:
          return ANARI_GEOMETRY_quad_primitive_attribute3_info(paramType, infoName, infoType);
-      case 54:
+      case 63:
          return ANARI_GEOMETRY_quad_primitive_id_info(paramType, infoName, infoType);
-      case 78:
+      case 91:
          return ANARI_GEOMETRY_quad_vertex_position_info(paramType, infoName, infoType);
-      case 77:
+      case 90:
          return ANARI_GEOMETRY_quad_vertex_normal_info(paramType, infoName, infoType);
-      case 80:
+      case 93:
          return ANARI_GEOMETRY_quad_vertex_tangent_info(paramType, infoName, infoType);
-      case 76:
+      case 89:
          return ANARI_GEOMETRY_quad_vertex_color_info(paramType, infoName, infoType);
-      case 71:
+      case 84:
          return ANARI_GEOMETRY_quad_vertex_attribute0_info(paramType, infoName, infoType);
-      case 72:
+      case 85:
          return ANARI_GEOMETRY_quad_vertex_attribute1_info(paramType, infoName, infoType);
-      case 73:
+      case 86:
          return ANARI_GEOMETRY_quad_vertex_attribute2_info(paramType, infoName, infoType);
-      case 74:
+      case 87:
          return ANARI_GEOMETRY_quad_vertex_attribute3_info(paramType, infoName, infoType);
-      case 55:
+      case 64:
          return ANARI_GEOMETRY_quad_primitive_index_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -5065,7 +5831,7 @@ static const void * ANARI_GEOMETRY_sphere_name_info(ANARIDataType paramType, int
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5090,7 +5856,7 @@ static const void * ANARI_GEOMETRY_sphere_color_info(ANARIDataType paramType, in
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5115,7 +5881,7 @@ static const void * ANARI_GEOMETRY_sphere_attribute0_info(ANARIDataType paramTyp
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5140,7 +5906,7 @@ static const void * ANARI_GEOMETRY_sphere_attribute1_info(ANARIDataType paramTyp
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5165,7 +5931,7 @@ static const void * ANARI_GEOMETRY_sphere_attribute2_info(ANARIDataType paramTyp
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5190,7 +5956,7 @@ static const void * ANARI_GEOMETRY_sphere_attribute3_info(ANARIDataType paramTyp
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5222,7 +5988,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_color_info(ANARIDataType par
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5254,7 +6020,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_attribute0_info(ANARIDataTyp
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5286,7 +6052,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_attribute1_info(ANARIDataTyp
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5318,7 +6084,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_attribute2_info(ANARIDataTyp
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5350,7 +6116,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_attribute3_info(ANARIDataTyp
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5382,7 +6148,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_id_info(ANARIDataType paramT
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5414,7 +6180,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_position_info(ANARIDataType par
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5446,7 +6212,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_radius_info(ANARIDataType param
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5478,7 +6244,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_color_info(ANARIDataType paramT
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5510,7 +6276,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute0_info(ANARIDataType p
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5542,7 +6308,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute1_info(ANARIDataType p
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5574,7 +6340,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute2_info(ANARIDataType p
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5606,7 +6372,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute3_info(ANARIDataType p
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5638,7 +6404,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_index_info(ANARIDataType par
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5663,7 +6429,7 @@ static const void * ANARI_GEOMETRY_sphere_radius_info(ANARIDataType paramType, i
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5671,47 +6437,47 @@ static const void * ANARI_GEOMETRY_sphere_radius_info(ANARIDataType paramType, i
 }
 static const void * ANARI_GEOMETRY_sphere_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 42:
+      case 48:
          return ANARI_GEOMETRY_sphere_name_info(paramType, infoName, infoType);
-      case 19:
+      case 24:
          return ANARI_GEOMETRY_sphere_color_info(paramType, infoName, infoType);
-      case 7:
-         return ANARI_GEOMETRY_sphere_attribute0_info(paramType, infoName, infoType);
       case 8:
-         return ANARI_GEOMETRY_sphere_attribute1_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_sphere_attribute0_info(paramType, infoName, infoType);
       case 9:
-         return ANARI_GEOMETRY_sphere_attribute2_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_sphere_attribute1_info(paramType, infoName, infoType);
       case 10:
+         return ANARI_GEOMETRY_sphere_attribute2_info(paramType, infoName, infoType);
+      case 11:
          return ANARI_GEOMETRY_sphere_attribute3_info(paramType, infoName, infoType);
-      case 53:
+      case 62:
          return ANARI_GEOMETRY_sphere_primitive_color_info(paramType, infoName, infoType);
-      case 49:
+      case 58:
          return ANARI_GEOMETRY_sphere_primitive_attribute0_info(paramType, infoName, infoType);
-      case 50:
+      case 59:
          return ANARI_GEOMETRY_sphere_primitive_attribute1_info(paramType, infoName, infoType);
-      case 51:
+      case 60:
          return ANARI_GEOMETRY_sphere_primitive_attribute2_info(paramType, infoName, infoType);
-      case 52:
+      case 61:
          return ANARI_GEOMETRY_sphere_primitive_attribute3_info(paramType, infoName, infoType);
-      case 54:
+      case 63:
          return ANARI_GEOMETRY_sphere_primitive_id_info(paramType, infoName, infoType);
-      case 78:
+      case 91:
          return ANARI_GEOMETRY_sphere_vertex_position_info(paramType, infoName, infoType);
-      case 79:
+      case 92:
          return ANARI_GEOMETRY_sphere_vertex_radius_info(paramType, infoName, infoType);
-      case 76:
+      case 89:
          return ANARI_GEOMETRY_sphere_vertex_color_info(paramType, infoName, infoType);
-      case 71:
+      case 84:
          return ANARI_GEOMETRY_sphere_vertex_attribute0_info(paramType, infoName, infoType);
-      case 72:
+      case 85:
          return ANARI_GEOMETRY_sphere_vertex_attribute1_info(paramType, infoName, infoType);
-      case 73:
+      case 86:
          return ANARI_GEOMETRY_sphere_vertex_attribute2_info(paramType, infoName, infoType);
-      case 74:
+      case 87:
          return ANARI_GEOMETRY_sphere_vertex_attribute3_info(paramType, infoName, infoType);
-      case 55:
+      case 64:
          return ANARI_GEOMETRY_sphere_primitive_index_info(paramType, infoName, infoType);
-      case 57:
+      case 66:
          return ANARI_GEOMETRY_sphere_radius_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -5736,7 +6502,7 @@ static const void * ANARI_GEOMETRY_triangle_name_info(ANARIDataType paramType, i
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -5761,7 +6527,7 @@ static const void * ANARI_GEOMETRY_triangle_color_info(ANARIDataType paramType,
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -5786,7 +6552,7 @@ static const void * ANARI_GEOMETRY_triangle_attribute0_info(ANARIDataType paramT
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -5811,7 +6577,7 @@ static const void * ANARI_GEOMETRY_triangle_attribute1_info(ANARIDataType paramT
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -5836,7 +6602,7 @@ static const void * ANARI_GEOMETRY_triangle_attribute2_info(ANARIDataType paramT
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -5861,7 +6627,7 @@ static const void * ANARI_GEOMETRY_triangle_attribute3_info(ANARIDataType paramT
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -5893,7 +6659,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_color_info(ANARIDataType p
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -5925,7 +6691,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_attribute0_info(ANARIDataT
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -5957,7 +6723,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_attribute1_info(ANARIDataT
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -5989,7 +6755,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_attribute2_info(ANARIDataT
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -6021,7 +6787,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_attribute3_info(ANARIDataT
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -6053,7 +6819,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_id_info(ANARIDataType para
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -6085,7 +6851,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_position_info(ANARIDataType p
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -6117,7 +6883,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_normal_info(ANARIDataType par
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -6149,7 +6915,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_tangent_info(ANARIDataType pa
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -6181,7 +6947,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_color_info(ANARIDataType para
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -6213,7 +6979,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute0_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -6245,7 +7011,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute1_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -6277,7 +7043,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute2_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -6309,7 +7075,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute3_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -6341,7 +7107,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_index_info(ANARIDataType p
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -6349,47 +7115,47 @@ static const void * ANARI_GEOMETRY_triangle_primitive_index_info(ANARIDataType p
 }
 static const void * ANARI_GEOMETRY_triangle_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 42:
+      case 48:
          return ANARI_GEOMETRY_triangle_name_info(paramType, infoName, infoType);
-      case 19:
+      case 24:
          return ANARI_GEOMETRY_triangle_color_info(paramType, infoName, infoType);
-      case 7:
-         return ANARI_GEOMETRY_triangle_attribute0_info(paramType, infoName, infoType);
       case 8:
-         return ANARI_GEOMETRY_triangle_attribute1_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_triangle_attribute0_info(paramType, infoName, infoType);
       case 9:
-         return ANARI_GEOMETRY_triangle_attribute2_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_triangle_attribute1_info(paramType, infoName, infoType);
       case 10:
+         return ANARI_GEOMETRY_triangle_attribute2_info(paramType, infoName, infoType);
+      case 11:
          return ANARI_GEOMETRY_triangle_attribute3_info(paramType, infoName, infoType);
-      case 53:
+      case 62:
          return ANARI_GEOMETRY_triangle_primitive_color_info(paramType, infoName, infoType);
-      case 49:
+      case 58:
          return ANARI_GEOMETRY_triangle_primitive_attribute0_info(paramType, infoName, infoType);
-      case 50:
+      case 59:
          return ANARI_GEOMETRY_triangle_primitive_attribute1_info(paramType, infoName, infoType);
-      case 51:
+      case 60:
          return ANARI_GEOMETRY_triangle_primitive_attribute2_info(paramType, infoName, infoType);
-      case 52:
+      case 61:
          return ANARI_GEOMETRY_triangle_primitive_attribute3_info(paramType, infoName, infoType);
-      case 54:
+      case 63:
          return ANARI_GEOMETRY_triangle_primitive_id_info(paramType, infoName, infoType);
-      case 78:
+      case 91:
          return ANARI_GEOMETRY_triangle_vertex_position_info(paramType, infoName, infoType);
-      case 77:
+      case 90:
          return ANARI_GEOMETRY_triangle_vertex_normal_info(paramType, infoName, infoType);
-      case 80:
+      case 93:
          return ANARI_GEOMETRY_triangle_vertex_tangent_info(paramType, infoName, infoType);
-      case 76:
+      case 89:
          return ANARI_GEOMETRY_triangle_vertex_color_info(paramType, infoName, infoType);
-      case 71:
+      case 84:
          return ANARI_GEOMETRY_triangle_vertex_attribute0_info(paramType, infoName, infoType);
-      case 72:
+      case 85:
          return ANARI_GEOMETRY_triangle_vertex_attribute1_info(paramType, infoName, infoType);
-      case 73:
+      case 86:
          return ANARI_GEOMETRY_triangle_vertex_attribute2_info(paramType, infoName, infoType);
-      case 74:
+      case 87:
          return ANARI_GEOMETRY_triangle_vertex_attribute3_info(paramType, infoName, infoType);
-      case 55:
+      case 64:
          return ANARI_GEOMETRY_triangle_primitive_index_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -6414,7 +7180,7 @@ static const void * ANARI_MATERIAL_matte_name_info(ANARIDataType paramType, int
             static const char *extension = "KHR_MATERIAL_MATTE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 16;
+            static const int32_t value = 17;
             return &value;
          }
       default: return nullptr;
@@ -6459,7 +7225,7 @@ static const void * ANARI_MATERIAL_matte_color_info(ANARIDataType paramType, int
             static const char *extension = "KHR_MATERIAL_MATTE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 16;
+            static const int32_t value = 17;
             return &value;
          }
       default: return nullptr;
@@ -6498,7 +7264,7 @@ static const void * ANARI_MATERIAL_matte_opacity_info(ANARIDataType paramType, i
             static const char *extension = "KHR_MATERIAL_MATTE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 16;
+            static const int32_t value = 17;
             return &value;
          }
       default: return nullptr;
@@ -6537,7 +7303,7 @@ static const void * ANARI_MATERIAL_matte_alphaMode_info(ANARIDataType paramType,
             static const char *extension = "KHR_MATERIAL_MATTE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 16;
+            static const int32_t value = 17;
             return &value;
          }
       default: return nullptr;
@@ -6569,7 +7335,7 @@ static const void * ANARI_MATERIAL_matte_alphaCutoff_info(ANARIDataType paramTyp
             static const char *extension = "KHR_MATERIAL_MATTE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 16;
+            static const int32_t value = 17;
             return &value;
          }
       default: return nullptr;
@@ -6577,15 +7343,15 @@ static const void * ANARI_MATERIAL_matte_alphaCutoff_info(ANARIDataType paramTyp
 }
 static const void * ANARI_MATERIAL_matte_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 42:
+      case 48:
          return ANARI_MATERIAL_matte_name_info(paramType, infoName, infoType);
-      case 19:
+      case 24:
          return ANARI_MATERIAL_matte_color_info(paramType, infoName, infoType);
-      case 44:
+      case 52:
          return ANARI_MATERIAL_matte_opacity_info(paramType, infoName, infoType);
-      case 2:
+      case 3:
          return ANARI_MATERIAL_matte_alphaMode_info(paramType, infoName, infoType);
-      case 1:
+      case 2:
          return ANARI_MATERIAL_matte_alphaCutoff_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -6610,7 +7376,7 @@ static const void * ANARI_SAMPLER_image1D_name_info(ANARIDataType paramType, int
             static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -6642,7 +7408,7 @@ static const void * ANARI_SAMPLER_image1D_image_info(ANARIDataType paramType, in
             static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -6681,7 +7447,7 @@ static const void * ANARI_SAMPLER_image1D_inAttribute_info(ANARIDataType paramTy
             static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -6720,7 +7486,7 @@ static const void * ANARI_SAMPLER_image1D_filter_info(ANARIDataType paramType, i
             static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -6759,7 +7525,7 @@ static const void * ANARI_SAMPLER_image1D_wrapMode1_info(ANARIDataType paramType
             static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -6791,7 +7557,7 @@ static const void * ANARI_SAMPLER_image1D_inTransform_info(ANARIDataType paramTy
             static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -6823,7 +7589,7 @@ static const void * ANARI_SAMPLER_image1D_inOffset_info(ANARIDataType paramType,
             static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -6855,7 +7621,7 @@ static const void * ANARI_SAMPLER_image1D_outTransform_info(ANARIDataType paramT
             static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -6887,7 +7653,7 @@ static const void * ANARI_SAMPLER_image1D_outOffset_info(ANARIDataType paramType
             static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -6895,23 +7661,23 @@ static const void * ANARI_SAMPLER_image1D_outOffset_info(ANARIDataType paramType
 }
 static const void * ANARI_SAMPLER_image1D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 42:
+      case 48:
          return ANARI_SAMPLER_image1D_name_info(paramType, infoName, infoType);
-      case 32:
+      case 38:
          return ANARI_SAMPLER_image1D_image_info(paramType, infoName, infoType);
-      case 34:
+      case 40:
          return ANARI_SAMPLER_image1D_inAttribute_info(paramType, infoName, infoType);
-      case 24:
+      case 30:
          return ANARI_SAMPLER_image1D_filter_info(paramType, infoName, infoType);
-      case 83:
+      case 96:
          return ANARI_SAMPLER_image1D_wrapMode1_info(paramType, infoName, infoType);
-      case 36:
+      case 42:
          return ANARI_SAMPLER_image1D_inTransform_info(paramType, infoName, infoType);
-      case 35:
+      case 41:
          return ANARI_SAMPLER_image1D_inOffset_info(paramType, infoName, infoType);
-      case 47:
+      case 55:
          return ANARI_SAMPLER_image1D_outTransform_info(paramType, infoName, infoType);
-      case 46:
+      case 54:
          return ANARI_SAMPLER_image1D_outOffset_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -6936,7 +7702,7 @@ static const void * ANARI_SAMPLER_image2D_name_info(ANARIDataType paramType, int
             static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 21;
+            static const int32_t value = 22;
             return &value;
          }
       default: return nullptr;
@@ -6968,7 +7734,7 @@ static const void * ANARI_SAMPLER_image2D_image_info(ANARIDataType paramType, in
             static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 21;
+            static const int32_t value = 22;
             return &value;
          }
       default: return nullptr;
@@ -7007,7 +7773,7 @@ static const void * ANARI_SAMPLER_image2D_inAttribute_info(ANARIDataType paramTy
             static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 21;
+            static const int32_t value = 22;
             return &value;
          }
       default: return nullptr;
@@ -7046,7 +7812,7 @@ static const void * ANARI_SAMPLER_image2D_filter_info(ANARIDataType paramType, i
             static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 21;
+            static const int32_t value = 22;
             return &value;
          }
       default: return nullptr;
@@ -7085,7 +7851,7 @@ static const void * ANARI_SAMPLER_image2D_wrapMode1_info(ANARIDataType paramType
             static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 21;
+            static const int32_t value = 22;
             return &value;
          }
       default: return nullptr;
@@ -7124,7 +7890,7 @@ static const void * ANARI_SAMPLER_image2D_wrapMode2_info(ANARIDataType paramType
             static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 21;
+            static const int32_t value = 22;
             return &value;
          }
       default: return nullptr;
@@ -7156,7 +7922,7 @@ static const void * ANARI_SAMPLER_image2D_inTransform_info(ANARIDataType paramTy
             static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 21;
+            static const int32_t value = 22;
             return &value;
          }
       default: return nullptr;
@@ -7188,7 +7954,7 @@ static const void * ANARI_SAMPLER_image2D_inOffset_info(ANARIDataType paramType,
             static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 21;
+            static const int32_t value = 22;
             return &value;
          }
       default: return nullptr;
@@ -7220,7 +7986,7 @@ static const void * ANARI_SAMPLER_image2D_outTransform_info(ANARIDataType paramT
             static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 21;
+            static const int32_t value = 22;
             return &value;
          }
       default: return nullptr;
@@ -7252,7 +8018,7 @@ static const void * ANARI_SAMPLER_image2D_outOffset_info(ANARIDataType paramType
             static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 21;
+            static const int32_t value = 22;
             return &value;
          }
       default: return nullptr;
@@ -7260,25 +8026,25 @@ static const void * ANARI_SAMPLER_image2D_outOffset_info(ANARIDataType paramType
 }
 static const void * ANARI_SAMPLER_image2D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 42:
+      case 48:
          return ANARI_SAMPLER_image2D_name_info(paramType, infoName, infoType);
-      case 32:
+      case 38:
          return ANARI_SAMPLER_image2D_image_info(paramType, infoName, infoType);
-      case 34:
+      case 40:
          return ANARI_SAMPLER_image2D_inAttribute_info(paramType, infoName, infoType);
-      case 24:
+      case 30:
          return ANARI_SAMPLER_image2D_filter_info(paramType, infoName, infoType);
-      case 83:
+      case 96:
          return ANARI_SAMPLER_image2D_wrapMode1_info(paramType, infoName, infoType);
-      case 84:
+      case 97:
          return ANARI_SAMPLER_image2D_wrapMode2_info(paramType, infoName, infoType);
-      case 36:
+      case 42:
          return ANARI_SAMPLER_image2D_inTransform_info(paramType, infoName, infoType);
-      case 35:
+      case 41:
          return ANARI_SAMPLER_image2D_inOffset_info(paramType, infoName, infoType);
-      case 47:
+      case 55:
          return ANARI_SAMPLER_image2D_outTransform_info(paramType, infoName, infoType);
-      case 46:
+      case 54:
          return ANARI_SAMPLER_image2D_outOffset_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -7303,7 +8069,7 @@ static const void * ANARI_SAMPLER_image3D_name_info(ANARIDataType paramType, int
             static const char *extension = "KHR_SAMPLER_IMAGE3D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 22;
+            static const int32_t value = 23;
             return &value;
          }
       default: return nullptr;
@@ -7335,7 +8101,7 @@ static const void * ANARI_SAMPLER_image3D_image_info(ANARIDataType paramType, in
             static const char *extension = "KHR_SAMPLER_IMAGE3D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 22;
+            static const int32_t value = 23;
             return &value;
          }
       default: return nullptr;
@@ -7374,7 +8140,7 @@ static const void * ANARI_SAMPLER_image3D_inAttribute_info(ANARIDataType paramTy
             static const char *extension = "KHR_SAMPLER_IMAGE3D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 22;
+            static const int32_t value = 23;
             return &value;
          }
       default: return nullptr;
@@ -7413,7 +8179,7 @@ static const void * ANARI_SAMPLER_image3D_filter_info(ANARIDataType paramType, i
             static const char *extension = "KHR_SAMPLER_IMAGE3D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 22;
+            static const int32_t value = 23;
             return &value;
          }
       default: return nullptr;
@@ -7452,7 +8218,7 @@ static const void * ANARI_SAMPLER_image3D_wrapMode1_info(ANARIDataType paramType
             static const char *extension = "KHR_SAMPLER_IMAGE3D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 22;
+            static const int32_t value = 23;
             return &value;
          }
       default: return nullptr;
@@ -7491,7 +8257,7 @@ static const void * ANARI_SAMPLER_image3D_wrapMode2_info(ANARIDataType paramType
             static const char *extension = "KHR_SAMPLER_IMAGE3D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 22;
+            static const int32_t value = 23;
             return &value;
          }
       default: return nullptr;
@@ -7530,7 +8296,7 @@ static const void * ANARI_SAMPLER_image3D_wrapMode3_info(ANARIDataType paramType
             static const char *extension = "KHR_SAMPLER_IMAGE3D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 22;
+            static const int32_t value = 23;
             return &value;
          }
       default: return nullptr;
@@ -7562,7 +8328,7 @@ static const void * ANARI_SAMPLER_image3D_inTransform_info(ANARIDataType paramTy
             static const char *extension = "KHR_SAMPLER_IMAGE3D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 22;
+            static const int32_t value = 23;
             return &value;
          }
       default: return nullptr;
@@ -7594,7 +8360,7 @@ static const void * ANARI_SAMPLER_image3D_inOffset_info(ANARIDataType paramType,
             static const char *extension = "KHR_SAMPLER_IMAGE3D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 22;
+            static const int32_t value = 23;
             return &value;
          }
       default: return nullptr;
@@ -7626,7 +8392,7 @@ static const void * ANARI_SAMPLER_image3D_outTransform_info(ANARIDataType paramT
             static const char *extension = "KHR_SAMPLER_IMAGE3D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 22;
+            static const int32_t value = 23;
             return &value;
          }
       default: return nullptr;
@@ -7658,7 +8424,7 @@ static const void * ANARI_SAMPLER_image3D_outOffset_info(ANARIDataType paramType
             static const char *extension = "KHR_SAMPLER_IMAGE3D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 22;
+            static const int32_t value = 23;
             return &value;
          }
       default: return nullptr;
@@ -7666,27 +8432,27 @@ static const void * ANARI_SAMPLER_image3D_outOffset_info(ANARIDataType paramType
 }
 static const void * ANARI_SAMPLER_image3D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 42:
+      case 48:
          return ANARI_SAMPLER_image3D_name_info(paramType, infoName, infoType);
-      case 32:
+      case 38:
          return ANARI_SAMPLER_image3D_image_info(paramType, infoName, infoType);
-      case 34:
+      case 40:
          return ANARI_SAMPLER_image3D_inAttribute_info(paramType, infoName, infoType);
-      case 24:
+      case 30:
          return ANARI_SAMPLER_image3D_filter_info(paramType, infoName, infoType);
-      case 83:
+      case 96:
          return ANARI_SAMPLER_image3D_wrapMode1_info(paramType, infoName, infoType);
-      case 84:
+      case 97:
          return ANARI_SAMPLER_image3D_wrapMode2_info(paramType, infoName, infoType);
-      case 85:
+      case 98:
          return ANARI_SAMPLER_image3D_wrapMode3_info(paramType, infoName, infoType);
-      case 36:
+      case 42:
          return ANARI_SAMPLER_image3D_inTransform_info(paramType, infoName, infoType);
-      case 35:
+      case 41:
          return ANARI_SAMPLER_image3D_inOffset_info(paramType, infoName, infoType);
-      case 47:
+      case 55:
          return ANARI_SAMPLER_image3D_outTransform_info(paramType, infoName, infoType);
-      case 46:
+      case 54:
          return ANARI_SAMPLER_image3D_outOffset_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -7711,7 +8477,7 @@ static const void * ANARI_SAMPLER_primitive_name_info(ANARIDataType paramType, i
             static const char *extension = "KHR_SAMPLER_PRIMITIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 23;
+            static const int32_t value = 24;
             return &value;
          }
       default: return nullptr;
@@ -7743,7 +8509,7 @@ static const void * ANARI_SAMPLER_primitive_array_info(ANARIDataType paramType,
             static const char *extension = "KHR_SAMPLER_PRIMITIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 23;
+            static const int32_t value = 24;
             return &value;
          }
       default: return nullptr;
@@ -7775,7 +8541,7 @@ static const void * ANARI_SAMPLER_primitive_inOffset_info(ANARIDataType paramTyp
             static const char *extension = "KHR_SAMPLER_PRIMITIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 23;
+            static const int32_t value = 24;
             return &value;
          }
       default: return nullptr;
@@ -7783,11 +8549,11 @@ static const void * ANARI_SAMPLER_primitive_inOffset_info(ANARIDataType paramTyp
 }
 static const void * ANARI_SAMPLER_primitive_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 42:
+      case 48:
          return ANARI_SAMPLER_primitive_name_info(paramType, infoName, infoType);
-      case 5:
+      case 6:
          return ANARI_SAMPLER_primitive_array_info(paramType, infoName, infoType);
-      case 35:
+      case 41:
          return ANARI_SAMPLER_primitive_inOffset_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -7812,7 +8578,7 @@ static const void * ANARI_SAMPLER_transform_name_info(ANARIDataType paramType, i
             static const char *extension = "KHR_SAMPLER_TRANSFORM";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 24;
+            static const int32_t value = 25;
             return &value;
          }
       default: return nullptr;
@@ -7848,174 +8614,7 @@ static const void * ANARI_SAMPLER_transform_inAttribute_info(ANARIDataType param
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_TRANSFORM";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 24;
-            return &value;
-         }
-      default: return nullptr;
-   }
-}
-static const void * ANARI_SAMPLER_transform_outTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   (void)paramType;
-   switch(infoName) {
-      case 0: // required
-         if(infoType == ANARI_BOOL) {
-            return &anari_false;
-         } else {
-            return nullptr;
-         }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
-            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
-      case 4: // description
-         {
-            static const char *description = "transform applied to the input attribute";
-            return description;
-         }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_TRANSFORM";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 24;
-            return &value;
-         }
-      default: return nullptr;
-   }
-}
-static const void * ANARI_SAMPLER_transform_outOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   (void)paramType;
-   switch(infoName) {
-      case 0: // required
-         if(infoType == ANARI_BOOL) {
-            return &anari_false;
-         } else {
-            return nullptr;
-         }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
-            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
-      case 4: // description
-         {
-            static const char *description = "offset added to output outTransform result";
-            return description;
-         }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_TRANSFORM";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 24;
-            return &value;
-         }
-      default: return nullptr;
-   }
-}
-static const void * ANARI_SAMPLER_transform_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 42:
-         return ANARI_SAMPLER_transform_name_info(paramType, infoName, infoType);
-      case 34:
-         return ANARI_SAMPLER_transform_inAttribute_info(paramType, infoName, infoType);
-      case 47:
-         return ANARI_SAMPLER_transform_outTransform_info(paramType, infoName, infoType);
-      case 46:
-         return ANARI_SAMPLER_transform_outOffset_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_SPATIAL_FIELD_structuredRegular_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   (void)paramType;
-   switch(infoName) {
-      case 0: // required
-         if(infoType == ANARI_BOOL) {
-            return &anari_false;
-         } else {
-            return nullptr;
-         }
-      case 4: // description
-         {
-            static const char *description = "optional object name";
-            return description;
-         }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 25;
-            return &value;
-         }
-      default: return nullptr;
-   }
-}
-static const void * ANARI_SPATIAL_FIELD_structuredRegular_data_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   (void)paramType;
-   switch(infoName) {
-      case 0: // required
-         if(infoType == ANARI_BOOL) {
-            return &anari_true;
-         } else {
-            return nullptr;
-         }
-      case 4: // description
-         {
-            static const char *description = "array of vertex centered scalar values";
-            return description;
-         }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT8, ANARI_INT16, ANARI_UINT16, ANARI_FLOAT32, ANARI_FLOAT64, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 25;
-            return &value;
-         }
-      default: return nullptr;
-   }
-}
-static const void * ANARI_SPATIAL_FIELD_structuredRegular_origin_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   (void)paramType;
-   switch(infoName) {
-      case 0: // required
-         if(infoType == ANARI_BOOL) {
-            return &anari_false;
-         } else {
-            return nullptr;
-         }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
-            static const float default_value[3] = {0.000000f, 0.000000f, 0.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
-      case 4: // description
-         {
-            static const char *description = "origin of the grid in object-space";
-            return description;
-         }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
+            static const char *extension = "KHR_SAMPLER_TRANSFORM";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 25;
@@ -8024,7 +8623,7 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_origin_info(ANARIDataT
       default: return nullptr;
    }
 }
-static const void * ANARI_SPATIAL_FIELD_structuredRegular_spacing_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_transform_outTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -8034,20 +8633,20 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_spacing_info(ANARIData
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
-            static const float default_value[3] = {1.000000f, 1.000000f, 1.000000f};
+         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
+            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "size of the grid cells in object-space";
+            static const char *description = "transform applied to the input attribute";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
+            static const char *extension = "KHR_SAMPLER_TRANSFORM";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 25;
@@ -8056,7 +8655,7 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_spacing_info(ANARIData
       default: return nullptr;
    }
 }
-static const void * ANARI_SPATIAL_FIELD_structuredRegular_filter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_transform_outOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -8066,27 +8665,20 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_filter_info(ANARIDataT
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "linear";
+         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
+            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "filter mode used to interpolate the grid";
+            static const char *description = "offset added to output outTransform result";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"nearest", "linear", nullptr};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
+            static const char *extension = "KHR_SAMPLER_TRANSFORM";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 25;
@@ -8095,18 +8687,16 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_filter_info(ANARIDataT
       default: return nullptr;
    }
 }
-static const void * ANARI_SPATIAL_FIELD_structuredRegular_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_transform_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 42:
-         return ANARI_SPATIAL_FIELD_structuredRegular_name_info(paramType, infoName, infoType);
-      case 20:
-         return ANARI_SPATIAL_FIELD_structuredRegular_data_info(paramType, infoName, infoType);
-      case 45:
-         return ANARI_SPATIAL_FIELD_structuredRegular_origin_info(paramType, infoName, infoType);
-      case 60:
-         return ANARI_SPATIAL_FIELD_structuredRegular_spacing_info(paramType, infoName, infoType);
-      case 24:
-         return ANARI_SPATIAL_FIELD_structuredRegular_filter_info(paramType, infoName, infoType);
+      case 48:
+         return ANARI_SAMPLER_transform_name_info(paramType, infoName, infoType);
+      case 40:
+         return ANARI_SAMPLER_transform_inAttribute_info(paramType, infoName, infoType);
+      case 55:
+         return ANARI_SAMPLER_transform_outTransform_info(paramType, infoName, infoType);
+      case 54:
+         return ANARI_SAMPLER_transform_outOffset_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
@@ -8215,18 +8805,18 @@ const void * query_param_info_enum(ANARIDataType type, const char *subtype, cons
          return ANARI_VOLUME_param_info(subtype, paramName, paramType, infoName, infoType);
       case ANARI_DEVICE:
          return ANARI_DEVICE_param_info(paramName, paramType, infoName, infoType);
+      case ANARI_WORLD:
+         return ANARI_WORLD_param_info(paramName, paramType, infoName, infoType);
+      case ANARI_GROUP:
+         return ANARI_GROUP_param_info(paramName, paramType, infoName, infoType);
+      case ANARI_FRAME:
+         return ANARI_FRAME_param_info(paramName, paramType, infoName, infoType);
       case ANARI_ARRAY1D:
          return ANARI_ARRAY1D_param_info(paramName, paramType, infoName, infoType);
       case ANARI_ARRAY2D:
          return ANARI_ARRAY2D_param_info(paramName, paramType, infoName, infoType);
       case ANARI_ARRAY3D:
          return ANARI_ARRAY3D_param_info(paramName, paramType, infoName, infoType);
-      case ANARI_FRAME:
-         return ANARI_FRAME_param_info(paramName, paramType, infoName, infoType);
-      case ANARI_GROUP:
-         return ANARI_GROUP_param_info(paramName, paramType, infoName, infoType);
-      case ANARI_WORLD:
-         return ANARI_WORLD_param_info(paramName, paramType, infoName, infoType);
       case ANARI_SURFACE:
          return ANARI_SURFACE_param_info(paramName, paramType, infoName, infoType);
       default:
@@ -8249,6 +8839,13 @@ static const void * ANARI_DEVICE_info(int infoName, ANARIDataType infoType) {
             static const ANARIParameter parameters[] = {
                {"allowInvalidMaterials", ANARI_BOOL},
                {"invalidMaterialColor", ANARI_FLOAT32_VEC4},
+               {"bvhBuildQuality", ANARI_STRING},
+               {"bvhDynamic", ANARI_BOOL},
+               {"bvhCompact", ANARI_BOOL},
+               {"bvhRobust", ANARI_BOOL},
+               {"numThreads", ANARI_INT32},
+               {"threadAffinity", ANARI_BOOL},
+               {"numaFirstTouch", ANARI_BOOL},
                {"name", ANARI_STRING},
                {"statusCallback", ANARI_STATUS_CALLBACK},
                {"statusCallbackUserData", ANARI_VOID_POINTER},
@@ -8266,6 +8863,7 @@ static const void * ANARI_DEVICE_info(int infoName, ANARIDataType infoType) {
                "ANARI_KHR_CAMERA_ORTHOGRAPHIC",
                "ANARI_KHR_CAMERA_PERSPECTIVE",
                "ANARI_KHR_DEVICE_SYNCHRONIZATION",
+               "ANARI_KHR_FRAME_ACCUMULATION",
                "ANARI_KHR_FRAME_CHANNEL_PRIMITIVE_ID",
                "ANARI_KHR_FRAME_CHANNEL_OBJECT_ID",
                "ANARI_KHR_FRAME_CHANNEL_INSTANCE_ID",
@@ -8308,8 +8906,8 @@ static const void * ANARI_RENDERER_default_info(int infoName, ANARIDataType info
             static const ANARIParameter parameters[] = {
                {"mode", ANARI_STRING},
                {"eyeLightBlendRatio", ANARI_FLOAT32},
-               {"taskGrainSizeWidth", ANARI_INT32},
-               {"taskGrainSizeHeight", ANARI_INT32},
+               {"tileSize", ANARI_INT32},
+               {"rayPacketSize", ANARI_INT32},
                {"name", ANARI_STRING},
                {"ambientColor", ANARI_FLOAT32_VEC3},
                {"ambientRadiance", ANARI_FLOAT32},
@@ -8329,6 +8927,7 @@ static const void * ANARI_RENDERER_default_info(int infoName, ANARIDataType info
                "ANARI_KHR_CAMERA_ORTHOGRAPHIC",
                "ANARI_KHR_CAMERA_PERSPECTIVE",
                "ANARI_KHR_DEVICE_SYNCHRONIZATION",
+               "ANARI_KHR_FRAME_ACCUMULATION",
                "ANARI_KHR_FRAME_CHANNEL_PRIMITIVE_ID",
                "ANARI_KHR_FRAME_CHANNEL_OBJECT_ID",
                "ANARI_KHR_FRAME_CHANNEL_INSTANCE_ID",
@@ -8359,52 +8958,53 @@ static const void * ANARI_RENDERER_default_info(int infoName, ANARIDataType info
       default: return nullptr;
    }
 }
-static const void * ANARI_INSTANCE_transform_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_VOLUME_transferFunction1D_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "instance object";
+            static const char *description = "transferFunction1D volume object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
+               {"preIntegration", ANARI_BOOL},
                {"name", ANARI_STRING},
-               {"transform", ANARI_FLOAT32_MAT4},
-               {"transform", ANARI_ARRAY1D},
-               {"group", ANARI_GROUP},
+               {"value", ANARI_SPATIAL_FIELD},
+               {"valueRange", ANARI_FLOAT32_BOX1},
+               {"valueRange", ANARI_FLOAT64_BOX1},
+               {"color", ANARI_FLOAT32_VEC4},
+               {"color", ANARI_FLOAT32_VEC3},
+               {"color", ANARI_ARRAY1D},
+               {"opacity", ANARI_FLOAT32},
+               {"opacity", ANARI_ARRAY1D},
+               {"unitDistance", ANARI_FLOAT32},
                {"id", ANARI_UINT32},
-               {"id", ANARI_ARRAY1D},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
          } else {
             return nullptr;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_INSTANCE_TRANSFORM";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int value = 0;
-            return &value;
-         } else {
-            return nullptr;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_ARRAY1D_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "one dimensional array object";
+            static const char *description = "structured regular spatial field object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
+               {"dataLayout", ANARI_STRING},
                {"name", ANARI_STRING},
+               {"data", ANARI_ARRAY3D},
+               {"origin", ANARI_FLOAT32_VEC3},
+               {"spacing", ANARI_FLOAT32_VEC3},
+               {"filter", ANARI_STRING},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -8414,17 +9014,25 @@ static const void * ANARI_ARRAY1D_info(int infoName, ANARIDataType infoType) {
       default: return nullptr;
    }
 }
-static const void * ANARI_ARRAY2D_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_WORLD_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "two dimensional array object";
+            static const char *description = "world object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
+               {"bvhBuildQuality", ANARI_STRING},
+               {"bvhDynamic", ANARI_BOOL},
+               {"bvhCompact", ANARI_BOOL},
+               {"bvhRobust", ANARI_BOOL},
                {"name", ANARI_STRING},
+               {"instance", ANARI_ARRAY1D},
+               {"surface", ANARI_ARRAY1D},
+               {"volume", ANARI_ARRAY1D},
+               {"light", ANARI_ARRAY1D},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -8434,17 +9042,24 @@ static const void * ANARI_ARRAY2D_info(int infoName, ANARIDataType infoType) {
       default: return nullptr;
    }
 }
-static const void * ANARI_ARRAY3D_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_GROUP_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "three dimensional array object";
+            static const char *description = "group object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
+               {"bvhBuildQuality", ANARI_STRING},
+               {"bvhDynamic", ANARI_BOOL},
+               {"bvhCompact", ANARI_BOOL},
+               {"bvhRobust", ANARI_BOOL},
                {"name", ANARI_STRING},
+               {"surface", ANARI_ARRAY1D},
+               {"volume", ANARI_ARRAY1D},
+               {"light", ANARI_ARRAY1D},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -8464,6 +9079,9 @@ static const void * ANARI_FRAME_info(int infoName, ANARIDataType infoType) {
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
+               {"varianceThreshold", ANARI_FLOAT32},
+               {"renderRegion", ANARI_INT32_BOX2},
+               {"targetFrameTime", ANARI_FLOAT32},
                {"name", ANARI_STRING},
                {"world", ANARI_WORLD},
                {"renderer", ANARI_RENDERER},
@@ -8471,6 +9089,7 @@ static const void * ANARI_FRAME_info(int infoName, ANARIDataType infoType) {
                {"size", ANARI_UINT32_VEC2},
                {"channel.color", ANARI_DATA_TYPE},
                {"channel.depth", ANARI_DATA_TYPE},
+               {"accumulation", ANARI_BOOL},
                {"channel.primitiveId", ANARI_DATA_TYPE},
                {"channel.objectId", ANARI_DATA_TYPE},
                {"channel.instanceId", ANARI_DATA_TYPE},
@@ -8499,44 +9118,52 @@ static const void * ANARI_FRAME_info(int infoName, ANARIDataType infoType) {
       default: return nullptr;
    }
 }
-static const void * ANARI_GROUP_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_INSTANCE_transform_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "group object";
+            static const char *description = "instance object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
-               {"surface", ANARI_ARRAY1D},
-               {"volume", ANARI_ARRAY1D},
-               {"light", ANARI_ARRAY1D},
+               {"transform", ANARI_FLOAT32_MAT4},
+               {"transform", ANARI_ARRAY1D},
+               {"group", ANARI_GROUP},
+               {"id", ANARI_UINT32},
+               {"id", ANARI_ARRAY1D},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
          } else {
             return nullptr;
          }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_INSTANCE_TRANSFORM";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int value = 0;
+            return &value;
+         } else {
+            return nullptr;
+         }
       default: return nullptr;
    }
 }
-static const void * ANARI_WORLD_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_ARRAY1D_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "world object";
+            static const char *description = "one dimensional array object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
-               {"instance", ANARI_ARRAY1D},
-               {"surface", ANARI_ARRAY1D},
-               {"volume", ANARI_ARRAY1D},
-               {"light", ANARI_ARRAY1D},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -8546,20 +9173,17 @@ static const void * ANARI_WORLD_info(int infoName, ANARIDataType infoType) {
       default: return nullptr;
    }
 }
-static const void * ANARI_SURFACE_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_ARRAY2D_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "surface object";
+            static const char *description = "two dimensional array object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
-               {"geometry", ANARI_GEOMETRY},
-               {"material", ANARI_MATERIAL},
-               {"id", ANARI_UINT32},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -8569,40 +9193,43 @@ static const void * ANARI_SURFACE_info(int infoName, ANARIDataType infoType) {
       default: return nullptr;
    }
 }
-static const void * ANARI_VOLUME_transferFunction1D_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_ARRAY3D_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "transferFunction1D volume object";
+            static const char *description = "three dimensional array object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
-               {"value", ANARI_SPATIAL_FIELD},
-               {"valueRange", ANARI_FLOAT32_BOX1},
-               {"valueRange", ANARI_FLOAT64_BOX1},
-               {"color", ANARI_FLOAT32_VEC4},
-               {"color", ANARI_FLOAT32_VEC3},
-               {"color", ANARI_ARRAY1D},
-               {"opacity", ANARI_FLOAT32},
-               {"opacity", ANARI_ARRAY1D},
-               {"unitDistance", ANARI_FLOAT32},
-               {"id", ANARI_UINT32},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
          } else {
             return nullptr;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int value = 1;
-            return &value;
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SURFACE_info(int infoName, ANARIDataType infoType) {
+   switch(infoName) {
+      case 4: // description
+         {
+            static const char *description = "surface object";
+            return description;
+         }
+      case 9: // parameter
+         if(infoType == ANARI_PARAMETER_LIST) {
+            static const ANARIParameter parameters[] = {
+               {"name", ANARI_STRING},
+               {"geometry", ANARI_GEOMETRY},
+               {"material", ANARI_MATERIAL},
+               {"id", ANARI_UINT32},
+               {0, ANARI_UNKNOWN}
+            };
+            return parameters;
          } else {
             return nullptr;
          }
@@ -8728,7 +9355,7 @@ static const void * ANARI_GEOMETRY_cone_info(int infoName, ANARIDataType infoTyp
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 9;
+            static const int value = 10;
             return &value;
          } else {
             return nullptr;
@@ -8778,7 +9405,7 @@ static const void * ANARI_GEOMETRY_curve_info(int infoName, ANARIDataType infoTy
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 10;
+            static const int value = 11;
             return &value;
          } else {
             return nullptr;
@@ -8830,7 +9457,7 @@ static const void * ANARI_GEOMETRY_cylinder_info(int infoName, ANARIDataType inf
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 11;
+            static const int value = 12;
             return &value;
          } else {
             return nullptr;
@@ -8880,7 +9507,7 @@ static const void * ANARI_GEOMETRY_quad_info(int infoName, ANARIDataType infoTyp
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 12;
+            static const int value = 13;
             return &value;
          } else {
             return nullptr;
@@ -8930,7 +9557,7 @@ static const void * ANARI_GEOMETRY_sphere_info(int infoName, ANARIDataType infoT
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 13;
+            static const int value = 14;
             return &value;
          } else {
             return nullptr;
@@ -8980,7 +9607,7 @@ static const void * ANARI_GEOMETRY_triangle_info(int infoName, ANARIDataType inf
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 14;
+            static const int value = 15;
             return &value;
          } else {
             return nullptr;
@@ -9018,7 +9645,7 @@ static const void * ANARI_MATERIAL_matte_info(int infoName, ANARIDataType infoTy
             static const char *extension = "KHR_MATERIAL_MATTE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 16;
+            static const int value = 17;
             return &value;
          } else {
             return nullptr;
@@ -9056,7 +9683,7 @@ static const void * ANARI_SAMPLER_image1D_info(int infoName, ANARIDataType infoT
             static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 20;
+            static const int value = 21;
             return &value;
          } else {
             return nullptr;
@@ -9095,7 +9722,7 @@ static const void * ANARI_SAMPLER_image2D_info(int infoName, ANARIDataType infoT
             static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 21;
+            static const int value = 22;
             return &value;
          } else {
             return nullptr;
@@ -9135,7 +9762,7 @@ static const void * ANARI_SAMPLER_image3D_info(int infoName, ANARIDataType infoT
             static const char *extension = "KHR_SAMPLER_IMAGE3D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 22;
+            static const int value = 23;
             return &value;
          } else {
             return nullptr;
@@ -9167,7 +9794,7 @@ static const void * ANARI_SAMPLER_primitive_info(int infoName, ANARIDataType inf
             static const char *extension = "KHR_SAMPLER_PRIMITIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 23;
+            static const int value = 24;
             return &value;
          } else {
             return nullptr;
@@ -9199,40 +9826,6 @@ static const void * ANARI_SAMPLER_transform_info(int infoName, ANARIDataType inf
          if(infoType == ANARI_STRING) {
             static const char *extension = "KHR_SAMPLER_TRANSFORM";
             return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int value = 24;
-            return &value;
-         } else {
-            return nullptr;
-         }
-      default: return nullptr;
-   }
-}
-static const void * ANARI_SPATIAL_FIELD_structuredRegular_info(int infoName, ANARIDataType infoType) {
-   switch(infoName) {
-      case 4: // description
-         {
-            static const char *description = "structured regular spatial field object";
-            return description;
-         }
-      case 9: // parameter
-         if(infoType == ANARI_PARAMETER_LIST) {
-            static const ANARIParameter parameters[] = {
-               {"name", ANARI_STRING},
-               {"data", ANARI_ARRAY3D},
-               {"origin", ANARI_FLOAT32_VEC3},
-               {"spacing", ANARI_FLOAT32_VEC3},
-               {"filter", ANARI_STRING},
-               {0, ANARI_UNKNOWN}
-            };
-            return parameters;
-         } else {
-            return nullptr;
-         }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
-            return extension;
          } else if(infoType == ANARI_INT32) {
             static const int value = 25;
             return &value;
@@ -9346,18 +9939,18 @@ const void * query_object_info_enum(ANARIDataType type, const char *subtype, int
          return ANARI_VOLUME_info(subtype, infoName, infoType);
       case ANARI_DEVICE:
          return ANARI_DEVICE_info(infoName, infoType);
+      case ANARI_WORLD:
+         return ANARI_WORLD_info(infoName, infoType);
+      case ANARI_GROUP:
+         return ANARI_GROUP_info(infoName, infoType);
+      case ANARI_FRAME:
+         return ANARI_FRAME_info(infoName, infoType);
       case ANARI_ARRAY1D:
          return ANARI_ARRAY1D_info(infoName, infoType);
       case ANARI_ARRAY2D:
          return ANARI_ARRAY2D_info(infoName, infoType);
       case ANARI_ARRAY3D:
          return ANARI_ARRAY3D_info(infoName, infoType);
-      case ANARI_FRAME:
-         return ANARI_FRAME_info(infoName, infoType);
-      case ANARI_GROUP:
-         return ANARI_GROUP_info(infoName, infoType);
-      case ANARI_WORLD:
-         return ANARI_WORLD_info(infoName, infoType);
       case ANARI_SURFACE:
          return ANARI_SURFACE_info(infoName, infoType);
       default:
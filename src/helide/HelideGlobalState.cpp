@@ -3,17 +3,147 @@
 
 #include "HelideGlobalState.h"
 #include "frame/Frame.h"
+// std
+#include <algorithm>
+#include <numeric>
 
 namespace helide {
 
+// Helper functions ///////////////////////////////////////////////////////////
+
+static void setSceneFlag(EmbreeBVHSettings &s, RTCSceneFlags flag, bool on)
+{
+  s.sceneFlags =
+      RTCSceneFlags(on ? (s.sceneFlags | flag) : (s.sceneFlags & ~flag));
+}
+
+// HelideGlobalState definitions //////////////////////////////////////////////
+
 HelideGlobalState::HelideGlobalState(ANARIDevice d)
     : helium::BaseGlobalDeviceState(d)
 {}
 
-void HelideGlobalState::waitOnCurrentFrame() const
+void HelideGlobalState::addFrameInFlight(const Frame *f)
 {
-  if (currentFrame)
-    currentFrame->wait();
+  std::lock_guard<std::mutex> lock(m_framesMutex);
+  m_framesInFlight.push_back(f);
+}
+
+void HelideGlobalState::removeFrameInFlight(const Frame *f)
+{
+  std::lock_guard<std::mutex> lock(m_framesMutex);
+  auto &frames = m_framesInFlight;
+  frames.erase(std::remove(frames.begin(), frames.end(), f), frames.end());
+}
+
+void HelideGlobalState::waitOnFramesInFlight()
+{
+  // Frame::wait() removes the frame from the list, so wait on a copy
+  std::vector<const Frame *> frames;
+  {
+    std::lock_guard<std::mutex> lock(m_framesMutex);
+    frames = m_framesInFlight;
+  }
+
+  for (auto *f : frames)
+    f->wait();
+}
+
+RTCBuffer HelideGlobalState::identityIndexBuffer(size_t numIndices)
+{
+  std::lock_guard<std::mutex> lock(m_identityIndexMutex);
+
+  if (!m_identityIndexBuffer || numIndices > m_identityIndexBufferSize) {
+    // Grow geometrically so a series of increasingly large geometries doesn't
+    // reallocate and refill the buffer every time
+    const size_t size = std::max(
+        {numIndices, m_identityIndexBufferSize * 3 / 2, size_t(1)});
+    auto buffer = rtcNewBuffer(embreeDevice, size * sizeof(uint32_t));
+    auto *indices = (uint32_t *)rtcGetBufferData(buffer);
+    std::iota(indices, indices + size, 0u);
+
+    // Geometries still using the previous buffer retained it when it was set
+    rtcReleaseBuffer(m_identityIndexBuffer);
+    m_identityIndexBuffer = buffer;
+    m_identityIndexBufferSize = size;
+  }
+
+  return m_identityIndexBuffer;
+}
+
+void HelideGlobalState::releaseIdentityIndexBuffer()
+{
+  std::lock_guard<std::mutex> lock(m_identityIndexMutex);
+  rtcReleaseBuffer(m_identityIndexBuffer);
+  m_identityIndexBuffer = nullptr;
+  m_identityIndexBufferSize = 0;
+}
+
+// EmbreeBVHSettings definitions //////////////////////////////////////////////
+
+bool readEmbreeBVHSettings(
+    const helium::ParameterizedObject &o, EmbreeBVHSettings &settings)
+{
+  auto readFlag = [&](const char *name, RTCSceneFlags flag) {
+    const bool on = settings.sceneFlags & flag;
+    setSceneFlag(settings, flag, o.getParam<bool>(name, on));
+  };
+
+  readFlag("bvhDynamic", RTC_SCENE_FLAG_DYNAMIC);
+  readFlag("bvhCompact", RTC_SCENE_FLAG_COMPACT);
+  readFlag("bvhRobust", RTC_SCENE_FLAG_ROBUST);
+
+  if (!o.hasParam("bvhBuildQuality"))
+    return true;
+
+  const auto quality = o.getParamString("bvhBuildQuality", "");
+  if (quality == "low")
+    settings.buildQuality = RTC_BUILD_QUALITY_LOW;
+  else if (quality == "medium")
+    settings.buildQuality = RTC_BUILD_QUALITY_MEDIUM;
+  else if (quality == "high")
+    settings.buildQuality = RTC_BUILD_QUALITY_HIGH;
+  else
+    return false;
+
+  return true;
+}
+
+void setEmbreeSceneSettings(RTCScene scene, const EmbreeBVHSettings &settings)
+{
+  rtcSetSceneBuildQuality(scene, settings.buildQuality);
+  rtcSetSceneFlags(scene, settings.sceneFlags);
+}
+
+std::string toString(const EmbreeBVHSettings &settings)
+{
+  std::string s = "quality=";
+  switch (settings.buildQuality) {
+  case RTC_BUILD_QUALITY_LOW:
+    s += "low";
+    break;
+  case RTC_BUILD_QUALITY_HIGH:
+    s += "high";
+    break;
+  default:
+    s += "medium";
+    break;
+  }
+
+  s += " flags=";
+  const auto flags = settings.sceneFlags;
+  if (flags & RTC_SCENE_FLAG_DYNAMIC)
+    s += "dynamic|";
+  if (flags & RTC_SCENE_FLAG_COMPACT)
+    s += "compact|";
+  if (flags & RTC_SCENE_FLAG_ROBUST)
+    s += "robust|";
+  if (s.back() == '|')
+    s.pop_back();
+  else
+    s += "none";
+
+  return s;
 }
 
 } // namespace helide
\ No newline at end of file
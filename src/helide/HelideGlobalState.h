@@ -3,30 +3,54 @@
 
 #pragma once
 
+#include "FrameLauncher.h"
 #include "RenderingSemaphore.h"
 #include "HelideMath.h"
 // helium
 #include "helium/BaseGlobalDeviceState.h"
+#include "helium/utility/ParameterizedObject.h"
 // embree
 #include "embree4/rtcore.h"
+// std
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
 
 namespace helide {
 
 struct Frame;
 
+// How Embree builds a scene's BVH, set by the "bvhBuildQuality", "bvhDynamic",
+// "bvhCompact" and "bvhRobust" parameters of the device, worlds and groups
+struct EmbreeBVHSettings
+{
+  RTCBuildQuality buildQuality{RTC_BUILD_QUALITY_MEDIUM};
+  RTCSceneFlags sceneFlags{RTC_SCENE_FLAG_NONE};
+};
+
 struct HelideGlobalState : public helium::BaseGlobalDeviceState
 {
-  int numThreads{1};
+  int numThreads{0}; // Embree worker threads, 0 uses all hardware threads
+  bool threadAffinity{false}; // pin Embree worker threads to cores
+  bool numaFirstTouch{false}; // let render threads place frame buffers
+  int nativeRayPacketSize{1}; // widest ray packet Embree supports natively
 
   struct ObjectUpdates
   {
     helium::TimeStamp lastBLSReconstructSceneRequest{0};
+    helium::TimeStamp lastBLSReconstructAllRequest{0};
     helium::TimeStamp lastBLSCommitSceneRequest{0};
     helium::TimeStamp lastTLSReconstructSceneRequest{0};
+    helium::TimeStamp lastTLSCommitSceneRequest{0};
   } objectUpdates;
 
   RenderingSemaphore renderingSemaphore;
-  Frame *currentFrame{nullptr};
+  FrameLauncher frameLauncher;
+
+  // Frames hold this shared while tracing rays, committing objects and
+  // updating Embree scenes requires it exclusively
+  std::shared_mutex sceneMutex;
 
   anari::Device anariDevice{nullptr}; // public handle of _this_ helide instance
   RTCDevice embreeDevice{nullptr};
@@ -34,14 +58,39 @@ struct HelideGlobalState : public helium::BaseGlobalDeviceState
   bool allowInvalidSurfaceMaterials{true};
   float4 invalidMaterialColor{1.f, 0.f, 1.f, 1.f};
 
+  EmbreeBVHSettings bvhDefaults; // used by groups and geometries
+
   // Helper methods //
 
   HelideGlobalState(ANARIDevice d);
-  void waitOnCurrentFrame() const;
+  void addFrameInFlight(const Frame *f);
+  void removeFrameInFlight(const Frame *f);
+  void waitOnFramesInFlight();
+
+  // Buffer holding at least 'numIndices' consecutive uint32 0, 1, 2..., shared
+  // by all geometries without an index array. It is replaced by a larger one
+  // as needed, set it with rtcSetGeometryBuffer() which retains it.
+  RTCBuffer identityIndexBuffer(size_t numIndices);
+  void releaseIdentityIndexBuffer();
+
+ private:
+  std::mutex m_framesMutex;
+  std::vector<const Frame *> m_framesInFlight;
+
+  std::mutex m_identityIndexMutex;
+  RTCBuffer m_identityIndexBuffer{nullptr};
+  size_t m_identityIndexBufferSize{0};
 };
 
 // Helper functions/macros ////////////////////////////////////////////////////
 
+// Overwrite the settings with the "bvh*" parameters set on 'o', returns false
+// if "bvhBuildQuality" is not one of "low", "medium" or "high"
+bool readEmbreeBVHSettings(
+    const helium::ParameterizedObject &o, EmbreeBVHSettings &settings);
+void setEmbreeSceneSettings(RTCScene scene, const EmbreeBVHSettings &settings);
+std::string toString(const EmbreeBVHSettings &settings);
+
 inline HelideGlobalState *asHelideState(helium::BaseGlobalDeviceState *s)
 {
   return (HelideGlobalState *)s;
@@ -8,8 +8,10 @@
 // embree
 #include <embree4/rtcore_common.h>
 // std
+#include <algorithm>
 #include <array>
 #include <optional>
+#include <vector>
 
 namespace helide {
 
@@ -49,6 +51,7 @@ struct VolumeRay
   Volume *volume{nullptr};
   uint32_t instID{RTC_INVALID_GEOMETRY_ID};
   uint32_t instArrayID{RTC_INVALID_GEOMETRY_ID};
+  float stepScale{1.f}; // multiplier on the volume's own step size
 };
 
 using UniformAttributeSet = std::array<std::optional<float4>, 5>;
@@ -59,4 +62,27 @@ inline const std::optional<float4> &getUniformAttribute(
   return ua[static_cast<int>(attr)];
 }
 
+// Uniform attributes of an instance stored per attribute, with one value per
+// transform array element (or a single one shared by all transforms), empty
+// for attributes the instance doesn't set
+using UniformAttributeTable = std::array<std::vector<float4>, 5>;
+
+// Uniform attributes of one instance transform, read one at a time by shading
+struct InstanceAttributes
+{
+  const UniformAttributeTable *table{nullptr};
+  uint32_t index{0};
+
+  const float4 *get(Attribute attr) const;
+};
+
+inline const float4 *InstanceAttributes::get(Attribute attr) const
+{
+  if (!table || attr == Attribute::NONE)
+    return nullptr;
+  const auto &values = (*table)[static_cast<int>(attr)];
+  return values.empty() ? nullptr
+                        : &values[std::min(size_t(index), values.size() - 1)];
+}
+
 } // namespace helide
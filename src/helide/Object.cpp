@@ -40,6 +40,20 @@ HelideGlobalState *Object::deviceState() const
   return (HelideGlobalState *)helium::BaseObject::m_state;
 }
 
+helium::TimeStamp Object::lastBLSChange() const
+{
+  return m_lastBLSChange;
+}
+
+void Object::markBLSChanged()
+{
+  // Groups compare against this on their next rebuild, they are not
+  // recommitted: that would also happen on every app-side commit
+  m_lastBLSChange = helium::newTimeStamp();
+  deviceState()->objectUpdates.lastBLSReconstructSceneRequest =
+      m_lastBLSChange;
+}
+
 // UnknownObject definitions //////////////////////////////////////////////////
 
 UnknownObject::UnknownObject(ANARIDataType type, HelideGlobalState *s)
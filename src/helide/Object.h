@@ -28,6 +28,15 @@ struct Object : public helium::BaseObject
   bool isValid() const override;
 
   HelideGlobalState *deviceState() const;
+
+  // Last commit which changed what a group BLS holding this object contains
+  helium::TimeStamp lastBLSChange() const;
+
+ protected:
+  void markBLSChanged();
+
+ private:
+  helium::TimeStamp m_lastBLSChange{0};
 };
 
 struct UnknownObject : public Object
@@ -23,7 +23,7 @@ struct RenderingSemaphore
   std::condition_variable m_conditionArrays;
   std::condition_variable m_conditionFrame;
   unsigned long m_arraysMapped{0};
-  bool m_frameInFlight{false};
+  unsigned long m_framesInFlight{0};
 };
 
 // Inlined definitions ////////////////////////////////////////////////////////
@@ -31,7 +31,7 @@ struct RenderingSemaphore
 inline void RenderingSemaphore::arrayMapAcquire()
 {
   std::unique_lock<std::mutex> frameLock(m_mutex);
-  m_conditionFrame.wait(frameLock, [&]() { return !m_frameInFlight; });
+  m_conditionFrame.wait(frameLock, [&]() { return m_framesInFlight == 0; });
   m_arraysMapped++;
 }
 
@@ -47,13 +47,15 @@ inline void RenderingSemaphore::frameStart()
 {
   std::unique_lock<std::mutex> arraysLock(m_mutex);
   m_conditionArrays.wait(arraysLock, [&]() { return m_arraysMapped == 0; });
-  m_frameInFlight = true;
+  m_framesInFlight++;
 }
 
 inline void RenderingSemaphore::frameEnd()
 {
-  m_frameInFlight = false;
-  m_conditionFrame.notify_all();
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_framesInFlight--;
+  if (m_framesInFlight == 0)
+    m_conditionFrame.notify_all();
 }
 
 } // namespace helide
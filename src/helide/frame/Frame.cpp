@@ -4,8 +4,13 @@
 #include "Frame.h"
 // std
 #include <algorithm>
+#include <array>
 #include <chrono>
+#include <cmath>
+#include <cstring>
+#include <mutex>
 #include <random>
+#include <shared_mutex>
 // embree
 #include "algorithms/parallel_for.h"
 
@@ -20,17 +25,161 @@ static void serial_for(I size, FUNC &&f)
     f(i);
 }
 
-template <typename R, typename TASK_T>
-static std::future<R> async(std::packaged_task<R()> &task, TASK_T &&fcn)
+static uint2 packetDimensions(int packetSize)
 {
-#if 1
-  return std::async(fcn);
-#else
-  task = std::packaged_task<R()>(std::forward<TASK_T>(fcn));
-  auto future = task.get_future();
-  embree::TaskScheduler::spawn([&]() { task(); });
-  return future;
-#endif
+  switch (packetSize) {
+  case 16:
+    return uint2(4, 4);
+  case 8:
+    return uint2(4, 2);
+  case 4:
+    return uint2(2, 2);
+  default:
+    return uint2(1, 1);
+  }
+}
+
+static uint32_t spreadBits(uint32_t x)
+{
+  x &= 0x0000ffff;
+  x = (x | (x << 8)) & 0x00ff00ff;
+  x = (x | (x << 4)) & 0x0f0f0f0f;
+  x = (x | (x << 2)) & 0x33333333;
+  x = (x | (x << 1)) & 0x55555555;
+  return x;
+}
+
+static uint32_t mortonCode(const uint2 &v)
+{
+  return spreadBits(v.x) | (spreadBits(v.y) << 1);
+}
+
+static uint32_t pcgHash(uint32_t v)
+{
+  const uint32_t state = v * 747796405u + 2891336453u;
+  const uint32_t word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+  return (word >> 22u) ^ word;
+}
+
+// The sRGB encoding table is indexed by the exponent and top 8 mantissa bits
+// of the linear value, covering [2^-20, 1), where 8 bit outputs are non-zero;
+// results are within one step of evaluating pow() per channel
+constexpr uint32_t SRGB_TABLE_BEGIN = 107 << 8;
+constexpr uint32_t SRGB_TABLE_END = 127 << 8;
+
+using SRGBTable = std::array<uint8_t, SRGB_TABLE_END - SRGB_TABLE_BEGIN>;
+
+static const SRGBTable &srgbTable()
+{
+  static const SRGBTable table = []() {
+    SRGBTable t;
+    for (uint32_t i = 0; i < t.size(); i++) {
+      // evaluate at the center of each bin
+      const uint32_t bits = ((i + SRGB_TABLE_BEGIN) << 15) | (1u << 14);
+      float v;
+      std::memcpy(&v, &bits, sizeof(v));
+      t[i] = uint8_t(
+          helium::math::cvt_color_to_uint32(helium::math::toneMap(v)));
+    }
+    return t;
+  }();
+  return table;
+}
+
+static uint8_t toUnorm8(float v)
+{
+  return uint8_t(255.f * std::clamp(v, 0.f, 1.f));
+}
+
+static uint8_t toSRGB8(const SRGBTable &table, float v)
+{
+  if (!(v > 0.f)) // also catches NaN
+    return 0;
+  if (v >= 1.f)
+    return 255;
+  uint32_t bits;
+  std::memcpy(&bits, &v, sizeof(bits));
+  const uint32_t i = bits >> 15;
+  return i < SRGB_TABLE_BEGIN ? 0 : table[i - SRGB_TABLE_BEGIN];
+}
+
+template <typename CVT_FCN>
+static void writeColorRowUnorm8(
+    const PixelSample *samples, uint32_t n, uint8_t *dst, CVT_FCN &&cvt)
+{
+  for (uint32_t i = 0; i < n; i++) {
+    const float4 &c = samples[i].color;
+    dst[4 * i + 0] = cvt(c.x);
+    dst[4 * i + 1] = cvt(c.y);
+    dst[4 * i + 2] = cvt(c.z);
+    dst[4 * i + 3] = toUnorm8(c.w);
+  }
+}
+
+static float toUnitFloat(uint32_t v)
+{
+  return (v >> 8) * (1.f / float(1u << 24));
+}
+
+static float2 pixelJitter(const uint2 &p, uint32_t sampleIndex)
+{
+  if (sampleIndex == 0)
+    return float2(0.f);
+  const uint32_t h = pcgHash(p.x + pcgHash(p.y + pcgHash(sampleIndex)));
+  return float2(toUnitFloat(h), toUnitFloat(pcgHash(h)));
+}
+
+static float luminance(const float4 &c)
+{
+  return 0.2126f * c.x + 0.7152f * c.y + 0.0722f * c.z;
+}
+
+// Limits of the frame time budget controller's work scale
+constexpr float MAX_SAMPLES_PER_FRAME = 16.f;
+constexpr float MAX_VOLUME_STEP_SCALE = 4.f;
+
+// Per-thread scratch space for the samples of one tile, which renderTile()
+// entirely overwrites, so it is only reallocated when tiles grow
+static PixelSample *tileSamples(uint32_t tileSize)
+{
+  thread_local std::vector<PixelSample> samples;
+  const size_t size = size_t(tileSize) * tileSize;
+  if (samples.size() < size)
+    samples.resize(size);
+  return samples.data();
+}
+
+using Clock = std::chrono::steady_clock;
+
+static float secondsBetween(Clock::time_point begin, Clock::time_point end)
+{
+  return std::chrono::duration<float>(end - begin).count();
+}
+
+// Returns true if the buffer was reallocated and left untouched
+template <typename T>
+static bool resizeBuffer(FrameBuffer<T> &buffer, size_t size, bool firstTouch)
+{
+  if (buffer.size() == size)
+    return false;
+
+  if (firstTouch && size > 0) {
+    FrameBuffer<T>().swap(buffer);
+    buffer.resize(size);
+    return true;
+  }
+
+  const size_t oldSize = std::min(buffer.size(), size);
+  buffer.resize(size);
+  std::fill(buffer.begin() + oldSize, buffer.end(), T{});
+  return false;
+}
+
+template <typename T>
+static void zeroBufferRange(FrameBuffer<T> &buffer, size_t begin, size_t end)
+{
+  if (!buffer.empty())
+    std::fill(buffer.begin() + begin, buffer.begin() + end, T{});
 }
 
 template <typename R>
@@ -92,24 +241,46 @@ void Frame::commit()
   m_frameData.size = getParam<uint2>("size", uint2(10));
   m_frameData.invSize = 1.f / float2(m_frameData.size);
 
-  const auto numPixels = m_frameData.size.x * m_frameData.size.y;
+  const size_t numPixels = size_t(m_frameData.size.x) * m_frameData.size.y;
+
+  // With first touch, reallocated buffers are only written by the rendering
+  // threads, which places their pages on those threads' NUMA nodes
+  const bool firstTouch = deviceState()->numaFirstTouch;
+  auto resize = [&](auto &buffer, size_t size) {
+    if (resizeBuffer(buffer, size, firstTouch))
+      m_firstTouchPending = true;
+  };
 
   m_perPixelBytes = 4 * (m_colorType == ANARI_FLOAT32_VEC4 ? 4 : 1);
-  m_pixelBuffer.resize(numPixels * m_perPixelBytes);
+  resize(m_pixelBuffer, numPixels * m_perPixelBytes);
 
-  m_depthBuffer.resize(m_depthType == ANARI_FLOAT32 ? numPixels : 0);
+  resize(m_depthBuffer, m_depthType == ANARI_FLOAT32 ? numPixels : 0);
   m_frameChanged = true;
 
-  m_primIdBuffer.clear();
-  m_objIdBuffer.clear();
-  m_instIdBuffer.clear();
+  // Pixels outside of the render region keep whatever was written last
+  const auto &size = m_frameData.size;
+  int4 region(0, 0, size.x, size.y);
+  getParam("renderRegion", ANARI_INT32_BOX2, &region);
+  region = linalg::max(region, int4(0));
+  m_renderRegion.lower = linalg::min(uint2(region.x, region.y), size);
+  m_renderRegion.upper = linalg::min(uint2(region.z, region.w), size);
+  if (m_renderRegion.lower.x >= m_renderRegion.upper.x
+      || m_renderRegion.lower.y >= m_renderRegion.upper.y) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "empty 'renderRegion' on frame, no pixels will be rendered");
+  }
+
+  m_accumulation = getParam<bool>("accumulation", false);
+  resize(m_accumBuffer, m_accumulation ? numPixels : 0);
+  resize(m_accumSqBuffer, m_accumulation ? numPixels : 0);
+  m_varianceThreshold =
+      std::max(getParam<float>("varianceThreshold", 0.f), 0.f);
 
-  if (m_primIdType == ANARI_UINT32)
-    m_primIdBuffer.resize(numPixels);
-  if (m_objIdType == ANARI_UINT32)
-    m_objIdBuffer.resize(numPixels);
-  if (m_instIdType == ANARI_UINT32)
-    m_instIdBuffer.resize(numPixels);
+  m_targetFrameTime = std::max(getParam<float>("targetFrameTime", 0.f), 0.f);
+
+  resize(m_primIdBuffer, m_primIdType == ANARI_UINT32 ? numPixels : 0);
+  resize(m_objIdBuffer, m_objIdType == ANARI_UINT32 ? numPixels : 0);
+  resize(m_instIdBuffer, m_instIdType == ANARI_UINT32 ? numPixels : 0);
 
   m_callback = getParam<ANARIFrameCompletionCallback>(
       "frameCompletionCallback", nullptr);
@@ -123,6 +294,33 @@ bool Frame::getProperty(
   if (type == ANARI_FLOAT32 && name == "duration") {
     helium::writeToVoidP(ptr, m_duration);
     return true;
+  } else if (type == ANARI_FLOAT32 && name == "variance" && m_accumulation) {
+    helium::writeToVoidP(ptr, m_variance);
+    return true;
+  } else if (type == ANARI_FLOAT32 && name == "duration.commitFlush") {
+    helium::writeToVoidP(ptr, m_stats.commitFlush);
+    return true;
+  } else if (type == ANARI_FLOAT32 && name == "duration.blsBuild") {
+    helium::writeToVoidP(ptr, m_stats.blsBuild);
+    return true;
+  } else if (type == ANARI_FLOAT32 && name == "duration.tlsBuild") {
+    helium::writeToVoidP(ptr, m_stats.tlsBuild);
+    return true;
+  } else if (type == ANARI_FLOAT32 && name == "duration.render") {
+    helium::writeToVoidP(ptr, m_stats.render);
+    return true;
+  } else if (type == ANARI_FLOAT32 && name == "duration.writeBack") {
+    helium::writeToVoidP(ptr, m_stats.writeBack);
+    return true;
+  } else if (type == ANARI_UINT64 && name == "stats.raysTraced") {
+    helium::writeToVoidP(ptr, m_stats.raysTraced);
+    return true;
+  } else if (type == ANARI_UINT64 && name == "stats.volumeSamples") {
+    helium::writeToVoidP(ptr, m_stats.volumeSamples);
+    return true;
+  } else if (type == ANARI_UINT32 && name == "stats.blsRebuilds") {
+    helium::writeToVoidP(ptr, m_stats.blsRebuilds);
+    return true;
   }
 
   return 0;
@@ -130,16 +328,43 @@ bool Frame::getProperty(
 
 void Frame::renderFrame()
 {
+  wait();
+
   this->refInc(helium::RefType::INTERNAL);
 
   auto *state = deviceState();
-  state->waitOnCurrentFrame();
-  state->currentFrame = this;
+  state->addFrameInFlight(this);
 
-  m_future = async<void>(m_task, [&, state]() {
+  m_future = state->frameLauncher.launch([&, state]() {
     auto start = std::chrono::steady_clock::now();
     state->renderingSemaphore.frameStart();
-    state->commitBufferFlush();
+
+    FrameStats stats;
+
+    // Other frames may be rendering concurrently: only take the scene
+    // exclusively when there is something to commit or rebuild
+    std::shared_lock<std::shared_mutex> sceneLock(state->sceneMutex);
+    while (sceneNeedsUpdate()) {
+      sceneLock.unlock();
+      {
+        std::unique_lock<std::shared_mutex> updateLock(state->sceneMutex);
+        const auto flushStart = Clock::now();
+        state->commitBufferFlush();
+        stats.commitFlush += secondsBetween(flushStart, Clock::now());
+        if (isValid()) {
+          const auto update = m_world->embreeSceneUpdate();
+          stats.blsBuild += update.blsBuildTime;
+          stats.tlsBuild += update.tlsBuildTime;
+          stats.blsRebuilds += update.blsRebuilds;
+        }
+      }
+      sceneLock.lock();
+    }
+
+    // Before anything else writes them, incomplete frames included, so that
+    // no channel is left uninitialized
+    if (m_firstTouchPending)
+      firstTouchBuffers();
 
     if (!isValid()) {
       reportMessage(
@@ -149,34 +374,78 @@ void Frame::renderFrame()
       return;
     }
 
-    if (state->commitBufferLastFlush() <= m_frameLastRendered) {
+    const bool sceneChanged =
+        state->commitBufferLastFlush() > m_frameLastRendered;
+    if (!sceneChanged && !m_accumulation && m_renderScale == 1) {
       state->renderingSemaphore.frameEnd();
       return;
     }
 
     m_frameLastRendered = helium::newTimeStamp();
 
-    m_world->embreeSceneUpdate();
-
-    const auto taskGrainSize = uint2(m_renderer->taskGrainSize());
-
-    const auto &size = m_frameData.size;
-    using Range = embree::range<uint32_t>;
-    embree::parallel_for(0u, size.y, taskGrainSize.y, [&](const Range &ry) {
-      for (auto y = ry.begin(); y < ry.end(); y++) {
-        embree::parallel_for(0u, size.x, taskGrainSize.x, [&](const Range &rx) {
-          for (auto x = rx.begin(); x < rx.end(); x++) {
-            auto screen = screenFromPixel(float2(x, y));
-            auto imageRegion = m_camera->imageRegion();
-            screen.x = linalg::lerp(imageRegion.x, imageRegion.z, screen.x);
-            screen.y = linalg::lerp(imageRegion.y, imageRegion.w, screen.y);
-            Ray ray = m_camera->createRay(screen);
-            writeSample(x, y, m_renderer->renderSample(screen, ray, *m_world));
-          }
-        });
+    if (updateTiles(m_renderer->tileSize()) || sceneChanged)
+      resetAccumulation();
+
+    // Only drop resolution while the scene is being interacted with, the
+    // next frame after updates stop refines back to full resolution
+    const uint32_t scale = sceneChanged ? interactiveRenderScale() : 1;
+
+    // Frames right after updates must cover every tile, otherwise stale
+    // tiles of the previous scene would remain visible
+    selectTiles(sceneChanged);
+    const uint32_t spp = scale == 1 ? samplesPerFrame() : 1;
+    const float volumeStepScale = this->volumeStepScale();
+
+    const auto renderStart = std::chrono::steady_clock::now();
+
+    // Threads time rendering and writing back their tiles separately, the
+    // totals split the wall clock time of the loop between the two phases
+    std::mutex statsMutex;
+    float tileRenderTime = 0.f;
+    float tileWriteTime = 0.f;
+
+    const auto numTiles = m_activeTiles.size();
+    const auto tileSize = m_tileSize;
+    using Range = embree::range<size_t>;
+    embree::parallel_for(size_t(0), numTiles, size_t(1), [&](const Range &r) {
+      auto *samples = tileSamples(tileSize);
+      FrameStats rangeStats;
+      for (auto i = r.begin(); i < r.end(); i++) {
+        auto &tile = m_tiles[m_activeTiles[i]];
+        for (uint32_t s = 0; s < spp && !tileConverged(tile); s++) {
+          const auto t0 = Clock::now();
+          renderTile(tile, samples, scale, volumeStepScale, rangeStats);
+          const auto t1 = Clock::now();
+          writeTile(tile, samples, scale);
+          const auto t2 = Clock::now();
+          rangeStats.render += secondsBetween(t0, t1);
+          rangeStats.writeBack += secondsBetween(t1, t2);
+        }
       }
+
+      std::lock_guard<std::mutex> lock(statsMutex);
+      tileRenderTime += rangeStats.render;
+      tileWriteTime += rangeStats.writeBack;
+      stats.raysTraced += rangeStats.raysTraced;
+      stats.volumeSamples += rangeStats.volumeSamples;
     });
 
+    const auto renderEnd = std::chrono::steady_clock::now();
+    const float renderTime =
+        std::chrono::duration<float>(renderEnd - renderStart).count();
+    const float tileTime = tileRenderTime + tileWriteTime;
+    stats.writeBack =
+        tileTime > 0.f ? renderTime * (tileWriteTime / tileTime) : 0.f;
+    stats.render = renderTime - stats.writeBack;
+    // Converged tiles are skipped when accumulating, which would make later
+    // frames underestimate the cost of re-rendering everything
+    if (sceneChanged || !m_accumulation)
+      m_fullResolutionRenderTime = renderTime * scale * scale;
+    m_renderScale = scale;
+
+    if (m_accumulation)
+      m_variance = estimateVariance();
+
     if (m_callback)
       m_callback(m_callbackUserPtr, state->anariDevice, (ANARIFrame)this);
 
@@ -184,6 +453,9 @@ void Frame::renderFrame()
 
     auto end = std::chrono::steady_clock::now();
     m_duration = std::chrono::duration<float>(end - start).count();
+    m_stats = stats;
+
+    updateWorkScale();
   });
 }
 
@@ -249,47 +521,355 @@ void Frame::wait() const
 {
   if (m_future.valid()) {
     m_future.get();
+    deviceState()->removeFrameInFlight(this);
     this->refDec(helium::RefType::INTERNAL);
-    if (deviceState()->currentFrame == this)
-      deviceState()->currentFrame = nullptr;
   }
 }
 
+uint32_t Frame::interactiveRenderScale() const
+{
+  constexpr uint32_t maxRenderScale = 8;
+  if (m_targetFrameTime <= 0.f || m_fullResolutionRenderTime <= 0.f)
+    return 1;
+
+  // Render time is proportional to the number of samples, which falls off
+  // with the square of the scale
+  const float scale =
+      std::ceil(std::sqrt(m_fullResolutionRenderTime / m_targetFrameTime));
+  return std::clamp(uint32_t(scale), 1u, maxRenderScale);
+}
+
+void Frame::updateWorkScale()
+{
+  if (m_targetFrameTime <= 0.f) {
+    m_workScale = 1.f;
+    return;
+  }
+
+  // Only move part of the way towards the work which would have exactly met
+  // the target, which keeps the loop stable with noisy frame times
+  const float ratio = m_targetFrameTime / std::max(m_duration, 1e-6f);
+  m_workScale *= std::clamp(std::sqrt(ratio), 0.5f, 2.f);
+
+  const float minScale = m_accumulation
+      ? 1.f / std::max(m_tiles.size(), size_t(1))
+      : 1.f / MAX_VOLUME_STEP_SCALE;
+  const float maxScale = m_accumulation ? MAX_SAMPLES_PER_FRAME : 1.f;
+  m_workScale = std::clamp(m_workScale, minScale, maxScale);
+}
+
+uint32_t Frame::samplesPerFrame() const
+{
+  return m_accumulation ? uint32_t(std::max(m_workScale, 1.f)) : 1;
+}
+
+float Frame::volumeStepScale() const
+{
+  // Accumulated images would keep the bias of coarser volume sampling, so
+  // they slow down convergence instead
+  return m_accumulation ? 1.f : 1.f / std::min(m_workScale, 1.f);
+}
+
+void Frame::selectTiles(bool allTiles)
+{
+  const size_t numTiles = m_tiles.size();
+  size_t count = numTiles;
+  if (!allTiles && m_accumulation && m_workScale < 1.f)
+    count = std::max(size_t(std::ceil(m_workScale * numTiles)), size_t(1));
+
+  // Rotate through the tiles so that all of them get refined in turn
+  m_activeTiles.clear();
+  size_t visited = 0;
+  for (; visited < numTiles && m_activeTiles.size() < count; visited++) {
+    const size_t i = (m_nextTile + visited) % numTiles;
+    if (!tileConverged(m_tiles[i]))
+      m_activeTiles.push_back(i);
+  }
+  m_nextTile = numTiles > 0 ? (m_nextTile + visited) % numTiles : 0;
+}
+
+void Frame::firstTouchBuffers()
+{
+  // Pages span whole rows of pixels rather than single tiles, so bands of
+  // tile rows are handed out instead: this spreads the buffers over the NUMA
+  // nodes in proportion to the workers on each
+  const auto &size = m_frameData.size;
+  const uint32_t bandRows = std::max(m_tileSize, 1u);
+  const size_t numBands = (size.y + bandRows - 1) / bandRows;
+
+  using Range = embree::range<size_t>;
+  embree::parallel_for(size_t(0), numBands, size_t(1), [&](const Range &r) {
+    for (auto b = r.begin(); b < r.end(); b++) {
+      const size_t begin = b * bandRows * size.x;
+      const size_t end =
+          std::min(size_t(b + 1) * bandRows, size_t(size.y)) * size.x;
+      zeroBufferRange(
+          m_pixelBuffer, begin * m_perPixelBytes, end * m_perPixelBytes);
+      zeroBufferRange(m_depthBuffer, begin, end);
+      zeroBufferRange(m_primIdBuffer, begin, end);
+      zeroBufferRange(m_objIdBuffer, begin, end);
+      zeroBufferRange(m_instIdBuffer, begin, end);
+      zeroBufferRange(m_accumBuffer, begin, end);
+      zeroBufferRange(m_accumSqBuffer, begin, end);
+    }
+  });
+
+  m_firstTouchPending = false;
+}
+
+bool Frame::sceneNeedsUpdate() const
+{
+  return !deviceState()->commitBufferEmpty()
+      || (isValid() && m_world->embreeSceneNeedsUpdate());
+}
+
 float2 Frame::screenFromPixel(const float2 &p) const
 {
-  return p * m_frameData.invSize;
+  auto screen = p * m_frameData.invSize;
+  auto imageRegion = m_camera->imageRegion();
+  screen.x = linalg::lerp(imageRegion.x, imageRegion.z, screen.x);
+  screen.y = linalg::lerp(imageRegion.y, imageRegion.w, screen.y);
+  return screen;
 }
 
-void Frame::writeSample(int x, int y, const PixelSample &s)
+bool Frame::updateTiles(uint32_t tileSize)
 {
-  const auto idx = y * m_frameData.size.x + x;
-  auto *color = m_pixelBuffer.data() + (idx * m_perPixelBytes);
-  switch (m_colorType) {
-  case ANARI_UFIXED8_VEC4: {
-    auto c = helium::math::cvt_color_to_uint32(s.color);
-    std::memcpy(color, &c, sizeof(c));
-    break;
+  const auto &region = m_renderRegion;
+  if (tileSize == m_tileSize && region.lower == m_tiledRegion.lower
+      && region.upper == m_tiledRegion.upper)
+    return false;
+
+  m_tileSize = tileSize;
+  m_tiledRegion = region;
+
+  m_tiles.clear();
+  if (region.lower.x >= region.upper.x || region.lower.y >= region.upper.y)
+    return true;
+
+  // Tiles stay aligned to the full frame's tile grid and are clipped to the
+  // region, so regions covering the whole frame tile it exactly as before
+  const uint2 firstTile = region.lower / tileSize;
+  const uint2 endTile = (region.upper + tileSize - 1u) / tileSize;
+  const uint2 numTiles = endTile - firstTile;
+
+  m_tiles.reserve(numTiles.x * numTiles.y);
+  for (uint32_t ty = firstTile.y; ty < endTile.y; ty++) {
+    for (uint32_t tx = firstTile.x; tx < endTile.x; tx++) {
+      Tile tile;
+      tile.begin = linalg::max(uint2(tx, ty) * tileSize, region.lower);
+      tile.end = linalg::min(uint2(tx + 1, ty + 1) * tileSize, region.upper);
+      m_tiles.push_back(tile);
+    }
   }
-  case ANARI_UFIXED8_RGBA_SRGB: {
-    auto c = helium::math::cvt_color_to_uint32_srgb(s.color);
-    std::memcpy(color, &c, sizeof(c));
-    break;
+
+  // Visit tiles along a Z-order curve so that consecutive tiles handed out to
+  // the same thread touch nearby BVH nodes and framebuffer memory
+  std::sort(m_tiles.begin(), m_tiles.end(), [&](const Tile &a, const Tile &b) {
+    return mortonCode(a.begin / tileSize) < mortonCode(b.begin / tileSize);
+  });
+
+  return true;
+}
+
+void Frame::resetAccumulation()
+{
+  // Tiles overwrite instead of accumulate their first sample, so there is no
+  // need to clear the accumulation buffers here
+  for (auto &tile : m_tiles) {
+    tile.numSamples = 0;
+    tile.variance = 0.f;
   }
-  case ANARI_FLOAT32_VEC4: {
-    std::memcpy(color, &s.color, sizeof(s.color));
-    break;
+  m_variance = std::numeric_limits<float>::infinity();
+}
+
+void Frame::renderTile(const Tile &tile,
+    PixelSample *samples,
+    uint32_t scale,
+    float volumeStepScale,
+    FrameStats &stats)
+{
+  const int packetSize = m_renderer->rayPacketSize();
+  const uint2 dims = packetDimensions(packetSize);
+  const uint32_t stride = tile.end.x - tile.begin.x;
+  const uint32_t sampleIndex = m_accumulation ? tile.numSamples : 0;
+
+  // Samples are taken once per block of scale x scale pixels, with blocks
+  // aligned to the frame, and fill the part of their block inside the tile
+  const uint2 begin = tile.begin / scale;
+  const uint2 end = (tile.end + scale - 1u) / scale;
+
+  auto blockScreen = [&](const uint2 &b) {
+    const uint2 p = b * scale;
+    const float2 center(0.5f * (scale - 1));
+    return screenFromPixel(float2(p) + center + pixelJitter(p, sampleIndex));
+  };
+
+  auto storeBlock = [&](const uint2 &b, const PixelSample &s) {
+    stats.raysTraced += s.numRays;
+    stats.volumeSamples += s.numVolumeSamples;
+
+    const uint2 lower = linalg::max(b * scale, tile.begin) - tile.begin;
+    const uint2 upper = linalg::min((b + 1u) * scale, tile.end) - tile.begin;
+    for (uint32_t y = lower.y; y < upper.y; y++) {
+      for (uint32_t x = lower.x; x < upper.x; x++)
+        samples[y * stride + x] = s;
+    }
+  };
+
+  if (packetSize == 1) {
+    for (uint32_t y = begin.y; y < end.y; y++) {
+      for (uint32_t x = begin.x; x < end.x; x++) {
+        const uint2 b(x, y);
+        auto screen = blockScreen(b);
+        Ray ray = m_camera->createRay(screen);
+        storeBlock(b,
+            m_renderer->renderSample(screen, ray, *m_world, volumeStepScale));
+      }
+    }
+    return;
   }
-  default:
-    break;
+
+  constexpr int MAX_PACKET_SIZE = 16;
+
+  float2 screen[MAX_PACKET_SIZE];
+  Ray rays[MAX_PACKET_SIZE];
+  alignas(64) int valid[MAX_PACKET_SIZE]; // see Renderer::renderPacket()
+  PixelSample packet[MAX_PACKET_SIZE];
+
+  for (uint32_t py = begin.y; py < end.y; py += dims.y) {
+    for (uint32_t px = begin.x; px < end.x; px += dims.x) {
+      for (int i = 0; i < packetSize; i++) {
+        const uint2 b(px + i % dims.x, py + i / dims.x);
+        valid[i] = b.x < end.x && b.y < end.y ? -1 : 0;
+        screen[i] = blockScreen(b);
+        rays[i] = m_camera->createRay(screen[i]);
+      }
+
+      m_renderer->renderPacket(packetSize,
+          screen,
+          rays,
+          valid,
+          *m_world,
+          volumeStepScale,
+          packet);
+
+      for (int i = 0; i < packetSize; i++) {
+        if (valid[i])
+          storeBlock(uint2(px + i % dims.x, py + i / dims.x), packet[i]);
+      }
+    }
+  }
+}
+
+void Frame::writeTile(Tile &tile, PixelSample *samples, uint32_t scale)
+{
+  // Reduced resolution samples are only a preview, they do not accumulate
+  if (m_accumulation && scale == 1) {
+    const bool firstSample = tile.numSamples == 0;
+    const float invN = 1.f / ++tile.numSamples;
+
+    float variance = 0.f;
+    auto *s = samples;
+    for (uint32_t y = tile.begin.y; y < tile.end.y; y++) {
+      const auto row = size_t(y) * m_frameData.size.x;
+      for (uint32_t x = tile.begin.x; x < tile.end.x; x++, s++) {
+        const auto idx = row + x;
+        const float l = luminance(s->color);
+
+        auto &acc = m_accumBuffer[idx];
+        auto &accSq = m_accumSqBuffer[idx];
+        acc = firstSample ? s->color : acc + s->color;
+        accSq = firstSample ? l * l : accSq + l * l;
+
+        // variance of the running mean, i.e. sample variance divided by N
+        const float mean = luminance(acc) * invN;
+        variance += std::max(accSq * invN - mean * mean, 0.f) * invN;
+
+        s->color = acc * invN;
+      }
+    }
+
+    tile.variance = variance;
   }
-  if (!m_depthBuffer.empty())
-    m_depthBuffer[idx] = s.depth;
-  if (!m_primIdBuffer.empty())
-    m_primIdBuffer[idx] = s.primId;
-  if (!m_objIdBuffer.empty())
-    m_objIdBuffer[idx] = s.objId;
-  if (!m_instIdBuffer.empty())
-    m_instIdBuffer[idx] = s.instId;
+
+  writeTileSamples(tile, samples);
+}
+
+void Frame::writeTileSamples(const Tile &tile, const PixelSample *samples)
+{
+  // Convert whole rows at a time with the format decided once per row, which
+  // keeps the per-channel loops free of branches so they vectorize
+  const uint32_t width = tile.end.x - tile.begin.x;
+  const auto &srgb = srgbTable();
+
+  for (uint32_t y = tile.begin.y; y < tile.end.y; y++, samples += width) {
+    const auto offset = size_t(y) * m_frameData.size.x + tile.begin.x;
+    auto *color = m_pixelBuffer.data() + (offset * m_perPixelBytes);
+    switch (m_colorType) {
+    case ANARI_UFIXED8_VEC4:
+      writeColorRowUnorm8(samples, width, color, toUnorm8);
+      break;
+    case ANARI_UFIXED8_RGBA_SRGB:
+      writeColorRowUnorm8(
+          samples, width, color, [&](float v) { return toSRGB8(srgb, v); });
+      break;
+    case ANARI_FLOAT32_VEC4: {
+      auto *dst = (float4 *)color;
+      for (uint32_t i = 0; i < width; i++)
+        dst[i] = samples[i].color;
+      break;
+    }
+    default:
+      break;
+    }
+
+    if (!m_depthBuffer.empty()) {
+      auto *dst = m_depthBuffer.data() + offset;
+      for (uint32_t i = 0; i < width; i++)
+        dst[i] = samples[i].depth;
+    }
+    if (!m_primIdBuffer.empty()) {
+      auto *dst = m_primIdBuffer.data() + offset;
+      for (uint32_t i = 0; i < width; i++)
+        dst[i] = samples[i].primId;
+    }
+    if (!m_objIdBuffer.empty()) {
+      auto *dst = m_objIdBuffer.data() + offset;
+      for (uint32_t i = 0; i < width; i++)
+        dst[i] = samples[i].objId;
+    }
+    if (!m_instIdBuffer.empty()) {
+      auto *dst = m_instIdBuffer.data() + offset;
+      for (uint32_t i = 0; i < width; i++)
+        dst[i] = samples[i].instId;
+    }
+  }
+}
+
+bool Frame::tileConverged(const Tile &tile) const
+{
+  // Require a few samples so that tiles which happen to agree on their first
+  // jittered samples are not retired early
+  constexpr uint32_t minSamples = 4;
+  if (!m_accumulation || m_varianceThreshold <= 0.f
+      || tile.numSamples < minSamples)
+    return false;
+
+  const auto size = tile.end - tile.begin;
+  return tile.variance <= m_varianceThreshold * (size.x * size.y);
+}
+
+float Frame::estimateVariance() const
+{
+  float variance = 0.f;
+  for (const auto &tile : m_tiles) {
+    if (tile.numSamples < 2)
+      return std::numeric_limits<float>::infinity();
+    variance += tile.variance;
+  }
+
+  const auto size = m_renderRegion.upper - m_renderRegion.lower;
+  return variance / std::max(size.x * size.y, 1u);
 }
 
 } // namespace helide
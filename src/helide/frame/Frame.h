@@ -10,10 +10,40 @@
 #include "helium/BaseFrame.h"
 // std
 #include <future>
+#include <limits>
+#include <memory>
+#include <type_traits>
 #include <vector>
 
 namespace helide {
 
+// Allocator leaving trivially copyable elements uninitialized, so that pages
+// of a buffer are placed by the threads which first write them
+template <typename T>
+struct UninitializedAllocator : public std::allocator<T>
+{
+  template <typename U>
+  struct rebind
+  {
+    using other = UninitializedAllocator<U>;
+  };
+
+  UninitializedAllocator() = default;
+  template <typename U>
+  UninitializedAllocator(const UninitializedAllocator<U> &) noexcept
+  {}
+
+  template <typename U, typename... ARGS>
+  void construct(U *p, ARGS &&...args)
+  {
+    if constexpr (sizeof...(ARGS) > 0 || !std::is_trivially_copyable_v<U>)
+      ::new ((void *)p) U(std::forward<ARGS>(args)...);
+  }
+};
+
+template <typename T>
+using FrameBuffer = std::vector<T, UninitializedAllocator<T>>;
+
 struct Frame : public helium::BaseFrame
 {
   Frame(HelideGlobalState *s);
@@ -44,8 +74,46 @@ struct Frame : public helium::BaseFrame
   void wait() const;
 
  private:
+  // Where the time of the last rendered frame went, in seconds
+  struct FrameStats
+  {
+    float commitFlush{0.f};
+    float blsBuild{0.f};
+    float tlsBuild{0.f};
+    float render{0.f};
+    float writeBack{0.f};
+    uint64_t raysTraced{0};
+    uint64_t volumeSamples{0};
+    uint32_t blsRebuilds{0};
+  };
+
+  struct Tile
+  {
+    uint2 begin;
+    uint2 end;
+    uint32_t numSamples{0}; // accumulated samples per pixel
+    float variance{0.f}; // summed variance of the pixel estimates
+  };
+
+  uint32_t interactiveRenderScale() const;
+  void updateWorkScale();
+  uint32_t samplesPerFrame() const;
+  float volumeStepScale() const;
+  void selectTiles(bool allTiles);
+  void firstTouchBuffers();
+  bool sceneNeedsUpdate() const;
   float2 screenFromPixel(const float2 &p) const;
-  void writeSample(int x, int y, const PixelSample &s);
+  bool updateTiles(uint32_t tileSize);
+  void resetAccumulation();
+  void renderTile(const Tile &tile,
+      PixelSample *samples,
+      uint32_t scale,
+      float volumeStepScale,
+      FrameStats &stats);
+  void writeTile(Tile &tile, PixelSample *samples, uint32_t scale);
+  void writeTileSamples(const Tile &tile, const PixelSample *samples);
+  bool tileConverged(const Tile &tile) const;
+  float estimateVariance() const;
 
   //// Data ////
 
@@ -65,17 +133,43 @@ struct Frame : public helium::BaseFrame
   anari::DataType m_objIdType{ANARI_UNKNOWN};
   anari::DataType m_instIdType{ANARI_UNKNOWN};
 
-  std::vector<uint8_t> m_pixelBuffer;
-  std::vector<float> m_depthBuffer;
-  std::vector<uint32_t> m_primIdBuffer;
-  std::vector<uint32_t> m_objIdBuffer;
-  std::vector<uint32_t> m_instIdBuffer;
+  FrameBuffer<uint8_t> m_pixelBuffer;
+  FrameBuffer<float> m_depthBuffer;
+  FrameBuffer<uint32_t> m_primIdBuffer;
+  FrameBuffer<uint32_t> m_objIdBuffer;
+  FrameBuffer<uint32_t> m_instIdBuffer;
+  bool m_firstTouchPending{false}; // buffers were allocated but not written
+
+  bool m_accumulation{false};
+  FrameBuffer<float4> m_accumBuffer;
+  FrameBuffer<float> m_accumSqBuffer; // squared luminance sums
+  float m_variance{std::numeric_limits<float>::infinity()};
+  float m_varianceThreshold{0.f};
+
+  struct PixelRegion
+  {
+    uint2 lower{0u};
+    uint2 upper{0u}; // exclusive
+  } m_renderRegion, m_tiledRegion;
+
+  std::vector<Tile> m_tiles; // sorted along a Morton curve
+  uint32_t m_tileSize{0};
+  std::vector<size_t> m_activeTiles; // tiles rendered by the current frame
+  size_t m_nextTile{0};
 
   helium::IntrusivePtr<Renderer> m_renderer;
   helium::IntrusivePtr<Camera> m_camera;
   helium::IntrusivePtr<World> m_world;
 
   float m_duration{0.f};
+  FrameStats m_stats;
+
+  float m_targetFrameTime{0.f}; // 0 disables dynamic resolution
+  float m_fullResolutionRenderTime{0.f}; // estimated from the last frame
+  uint32_t m_renderScale{1}; // pixels per sample along x/y in the last frame
+  // Amount of work per frame relative to one sample of every tile, adjusted
+  // from 'duration' to meet m_targetFrameTime
+  float m_workScale{1.f};
 
   bool m_frameChanged{false};
   helium::TimeStamp m_cameraLastChanged{0};
@@ -85,7 +179,6 @@ struct Frame : public helium::BaseFrame
   helium::TimeStamp m_frameLastRendered{0};
 
   mutable std::future<void> m_future;
-  std::packaged_task<void()> m_task;
 
   anari::FrameCompletionCallback m_callback{nullptr};
   const void *m_callbackUserPtr{nullptr};
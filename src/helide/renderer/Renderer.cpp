@@ -90,6 +90,42 @@ static float4 backgroundColorFromImage(
   return linalg::lerp(v0, v1, interp_x.frac);
 }
 
+template <int N>
+struct RayHitPacket;
+
+template <>
+struct RayHitPacket<4>
+{
+  using type = RTCRayHit4;
+  static void intersect(
+      const int *valid, RTCScene s, type &rh, RTCIntersectArguments *args)
+  {
+    rtcIntersect4(valid, s, &rh, args);
+  }
+};
+
+template <>
+struct RayHitPacket<8>
+{
+  using type = RTCRayHit8;
+  static void intersect(
+      const int *valid, RTCScene s, type &rh, RTCIntersectArguments *args)
+  {
+    rtcIntersect8(valid, s, &rh, args);
+  }
+};
+
+template <>
+struct RayHitPacket<16>
+{
+  using type = RTCRayHit16;
+  static void intersect(
+      const int *valid, RTCScene s, type &rh, RTCIntersectArguments *args)
+  {
+    rtcIntersect16(valid, s, &rh, args);
+  }
+};
+
 // Renderer definitions ///////////////////////////////////////////////////////
 
 Renderer::Renderer(HelideGlobalState *s) : Object(ANARI_RENDERER, s)
@@ -115,12 +151,24 @@ void Renderer::commit()
   m_ambientRadiance = getParam<float>("ambientRadiance", 1.f);
   m_falloffBlendRatio = getParam<float>("eyeLightBlendRatio", 0.5f);
   m_mode = renderModeFromString(getParamString("mode", "default"));
-  m_taskGrainSize.x = getParam<int32_t>("taskGrainSizeWidth", 4);
-  m_taskGrainSize.y = getParam<int32_t>("taskGrainSizeHeight", 4);
+  m_tileSize = uint32_t(std::clamp(getParam<int32_t>("tileSize", 16), 1, 256));
+
+  m_rayPacketSize = getParam<int32_t>("rayPacketSize", 0);
+  if (m_rayPacketSize == 0)
+    m_rayPacketSize = deviceState()->nativeRayPacketSize;
+  else if (m_rayPacketSize != 1 && m_rayPacketSize != 4
+      && m_rayPacketSize != 8 && m_rayPacketSize != 16) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "unsupported 'rayPacketSize' %i, tracing single rays instead",
+        m_rayPacketSize);
+    m_rayPacketSize = 1;
+  }
 }
 
-PixelSample Renderer::renderSample(
-    const float2 &screen, Ray ray, const World &w) const
+PixelSample Renderer::renderSample(const float2 &screen,
+    Ray ray,
+    const World &w,
+    float volumeStepScale) const
 {
   PixelSample retval;
 
@@ -130,17 +178,111 @@ PixelSample Renderer::renderSample(
   rtcInitIntersectArguments(&iargs);
   rtcIntersect1(w.embreeScene(), (RTCRayHit *)&ray, &iargs);
 
+  return shadeSample(screen, ray, w, volumeStepScale);
+}
+
+void Renderer::renderPacket(int size,
+    const float2 *screen,
+    Ray *rays,
+    const int *valid,
+    const World &w,
+    float volumeStepScale,
+    PixelSample *samples) const
+{
+  switch (size) {
+  case 16:
+    renderPacketN<16>(screen, rays, valid, w, volumeStepScale, samples);
+    break;
+  case 8:
+    renderPacketN<8>(screen, rays, valid, w, volumeStepScale, samples);
+    break;
+  case 4:
+    renderPacketN<4>(screen, rays, valid, w, volumeStepScale, samples);
+    break;
+  default:
+    for (int i = 0; i < size; i++) {
+      if (valid[i])
+        samples[i] = renderSample(screen[i], rays[i], w, volumeStepScale);
+    }
+    break;
+  }
+}
+
+template <int N>
+void Renderer::renderPacketN(const float2 *screen,
+    Ray *rays,
+    const int *valid,
+    const World &w,
+    float volumeStepScale,
+    PixelSample *samples) const
+{
+  // Intersect Surfaces //
+
+  typename RayHitPacket<N>::type rh;
+
+  for (int i = 0; i < N; i++) {
+    const Ray &r = rays[i];
+    rh.ray.org_x[i] = r.org.x;
+    rh.ray.org_y[i] = r.org.y;
+    rh.ray.org_z[i] = r.org.z;
+    rh.ray.tnear[i] = r.tnear;
+    rh.ray.dir_x[i] = r.dir.x;
+    rh.ray.dir_y[i] = r.dir.y;
+    rh.ray.dir_z[i] = r.dir.z;
+    rh.ray.time[i] = r.time;
+    rh.ray.tfar[i] = r.tfar;
+    rh.ray.mask[i] = r.mask;
+    rh.ray.id[i] = r.id;
+    rh.ray.flags[i] = r.flags;
+    rh.hit.primID[i] = RTC_INVALID_GEOMETRY_ID;
+    rh.hit.geomID[i] = RTC_INVALID_GEOMETRY_ID;
+    rh.hit.instID[0][i] = RTC_INVALID_GEOMETRY_ID;
+    rh.hit.instPrimID[0][i] = RTC_INVALID_GEOMETRY_ID;
+  }
+
+  RTCIntersectArguments iargs;
+  rtcInitIntersectArguments(&iargs);
+  iargs.flags = RTC_RAY_QUERY_FLAG_COHERENT;
+  RayHitPacket<N>::intersect(valid, w.embreeScene(), rh, &iargs);
+
+  // Shade //
+
+  for (int i = 0; i < N; i++) {
+    if (!valid[i])
+      continue;
+    Ray &r = rays[i];
+    r.tfar = rh.ray.tfar[i];
+    r.Ng = float3(rh.hit.Ng_x[i], rh.hit.Ng_y[i], rh.hit.Ng_z[i]);
+    r.u = rh.hit.u[i];
+    r.v = rh.hit.v[i];
+    r.primID = rh.hit.primID[i];
+    r.geomID = rh.hit.geomID[i];
+    r.instID = rh.hit.instID[0][i];
+    r.instArrayID = rh.hit.instPrimID[0][i];
+    samples[i] = shadeSample(screen[i], r, w, volumeStepScale);
+  }
+}
+
+PixelSample Renderer::shadeSample(const float2 &screen,
+    const Ray &ray,
+    const World &w,
+    float volumeStepScale) const
+{
+  PixelSample retval;
+
   // Intersect Volumes //
 
   VolumeRay vray;
   vray.org = ray.org;
   vray.dir = ray.dir;
   vray.t.upper = ray.tfar;
-  w.intersectVolumes(vray);
+  vray.stepScale = volumeStepScale;
+  const bool tracedVolumeRay = w.intersectVolumes(vray);
 
   // Shade //
 
   shadeRay(retval, screen, ray, vray, w);
+  retval.numRays = tracedVolumeRay ? 2 : 1; // counts the caller's surface ray
 
   return retval;
 }
@@ -261,13 +403,13 @@ void Renderer::shadeRay(PixelSample &retval,
       const Instance *inst = w.instanceFromRay(ray);
       const Surface *surface = w.surfaceFromRay(ray);
 
-      const auto n = linalg::mul(inst->xfmInvRot(), ray.Ng);
+      const auto n = linalg::mul(inst->xfmInvRot(ray.instArrayID), ray.Ng);
       const auto falloff =
           std::abs(linalg::dot(-ray.dir, linalg::normalize(n)));
       const float4 sc = surface->getSurfaceColor(
-          ray, inst->getUniformAttributes(ray.instArrayID));
+          ray, inst->uniformAttributes(ray.instArrayID));
       const float so = surface->getSurfaceOpacity(
-          ray, inst->getUniformAttributes(ray.instArrayID));
+          ray, inst->uniformAttributes(ray.instArrayID));
       const float o = surface->adjustedAlpha(std::clamp(sc.w * so, 0.f, 1.f));
       const float3 c = m_heatmap->valueAtLinear<float3>(o);
       const float3 fc = c * falloff;
@@ -284,7 +426,7 @@ void Renderer::shadeRay(PixelSample &retval,
       const auto falloff =
           std::abs(linalg::dot(-ray.dir, linalg::normalize(n)));
       const float4 c = surface->getSurfaceColor(
-          ray, inst->getUniformAttributes(ray.instArrayID));
+          ray, inst->uniformAttributes(ray.instArrayID));
       const float3 sc = float3(c.x, c.y, c.z) * std::clamp(falloff, 0.f, 1.f);
       geometryColor =
           ((m_falloffBlendRatio * sc)
@@ -293,7 +435,8 @@ void Renderer::shadeRay(PixelSample &retval,
     }
 
     if (hitVolume)
-      vray.volume->render(vray, volumeColor, volumeOpacity);
+      retval.numVolumeSamples =
+          vray.volume->render(vray, volumeColor, volumeOpacity);
 
   } break;
   }
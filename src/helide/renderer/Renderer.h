@@ -17,6 +17,8 @@ struct PixelSample
   uint32_t primId{~0u};
   uint32_t objId{~0u};
   uint32_t instId{~0u};
+  uint32_t numRays{0}; // rays traced for this sample
+  uint32_t numVolumeSamples{0}; // volume field samples taken
 };
 
 enum class RenderMode
@@ -52,14 +54,44 @@ struct Renderer : public Object
 
   virtual void commit() override;
 
-  int2 taskGrainSize() const;
-
-  PixelSample renderSample(const float2 &screen, Ray ray, const World &w) const;
+  uint32_t tileSize() const;
+  int rayPacketSize() const;
+
+  // 'volumeStepScale' trades volume sampling quality for speed, see VolumeRay
+  PixelSample renderSample(const float2 &screen,
+      Ray ray,
+      const World &w,
+      float volumeStepScale) const;
+
+  // Trace and shade a coherent packet of 'size' (1, 4, 8, or 16) rays, where
+  // lanes with valid[i] == 0 are ignored and leave samples[i] untouched.
+  // 'valid' is handed to rtcIntersect4/8/16 as is, so it must be aligned to
+  // 'size' ints (64 bytes covers all sizes), e.g. 'alignas(64) int valid[16]'
+  void renderPacket(int size,
+      const float2 *screen,
+      Ray *rays,
+      const int *valid,
+      const World &w,
+      float volumeStepScale,
+      PixelSample *samples) const;
 
   static Renderer *createInstance(
       std::string_view subtype, HelideGlobalState *d);
 
  private:
+  template <int N>
+  void renderPacketN(const float2 *screen,
+      Ray *rays,
+      const int *valid,
+      const World &w,
+      float volumeStepScale,
+      PixelSample *samples) const;
+
+  PixelSample shadeSample(const float2 &screen,
+      const Ray &ray,
+      const World &w,
+      float volumeStepScale) const;
+
   void shadeRay(PixelSample &retval,
       const float2 &screen,
       const Ray &ray,
@@ -70,7 +102,8 @@ struct Renderer : public Object
   float m_ambientRadiance{1.f};
   float m_falloffBlendRatio{0.5f};
   RenderMode m_mode{RenderMode::DEFAULT};
-  int2 m_taskGrainSize{4, 4};
+  uint32_t m_tileSize{16};
+  int m_rayPacketSize{1};
 
   helium::IntrusivePtr<Array1D> m_heatmap;
   helium::IntrusivePtr<Array2D> m_bgImage;
@@ -78,9 +111,14 @@ struct Renderer : public Object
 
 // Inlined definitions ////////////////////////////////////////////////////////
 
-inline int2 Renderer::taskGrainSize() const
+inline uint32_t Renderer::tileSize() const
+{
+  return m_tileSize;
+}
+
+inline int Renderer::rayPacketSize() const
 {
-  return m_taskGrainSize;
+  return m_rayPacketSize;
 }
 
 } // namespace helide
@@ -3,10 +3,80 @@
 
 #include "Group.h"
 // std
+#include <algorithm>
 #include <iterator>
 
 namespace helide {
 
+// Helper functions ///////////////////////////////////////////////////////////
+
+static void volumeBounds(const RTCBoundsFunctionArguments *args)
+{
+  const auto *group = (const Group *)args->geometryUserPtr;
+  const auto *v = group->volumes()[args->primID];
+  const box3 b = v->isValid() ? v->bounds() : box3{};
+
+  auto &bounds = *args->bounds_o;
+  bounds.lower_x = b.lower.x;
+  bounds.lower_y = b.lower.y;
+  bounds.lower_z = b.lower.z;
+  bounds.upper_x = b.upper.x;
+  bounds.upper_y = b.upper.y;
+  bounds.upper_z = b.upper.z;
+}
+
+static void volumeIntersect(const RTCIntersectFunctionNArguments *args)
+{
+  const auto *group = (const Group *)args->geometryUserPtr;
+  auto *v = group->volumes()[args->primID];
+  if (!v->isValid())
+    return;
+
+  const box3 bounds = v->bounds();
+  auto &ctx = *(VolumeRayQueryContext *)args->context;
+
+  const auto N = args->N;
+  RTCRayN *ray = RTCRayHitN_RayN(args->rayhit, N);
+  RTCHitN *hit = RTCRayHitN_HitN(args->rayhit, N);
+
+  // Volume queries are traced one ray at a time, so there is only one context
+  for (unsigned int i = 0; i < N; i++) {
+    if (!args->valid[i])
+      continue;
+
+    const float3 org(RTCRayN_org_x(ray, N, i),
+        RTCRayN_org_y(ray, N, i),
+        RTCRayN_org_z(ray, N, i));
+    const float3 dir(RTCRayN_dir_x(ray, N, i),
+        RTCRayN_dir_y(ray, N, i),
+        RTCRayN_dir_z(ray, N, i));
+
+    const float3 mins = (bounds.lower - org) * (1.f / dir);
+    const float3 maxs = (bounds.upper - org) * (1.f / dir);
+    const float3 nears = linalg::min(mins, maxs);
+    const float3 fars = linalg::max(mins, maxs);
+
+    float &tfar = RTCRayN_tfar(ray, N, i);
+    const float t0 = std::max(linalg::maxelem(nears), RTCRayN_tnear(ray, N, i));
+    const float t1 = std::min(linalg::minelem(fars), ctx.tMax);
+    if (t0 >= t1 || t0 >= tfar)
+      continue;
+
+    tfar = t0;
+    RTCHitN_geomID(hit, N, i) = args->geomID;
+    RTCHitN_primID(hit, N, i) = args->primID;
+    RTCHitN_instID(hit, N, i, 0) = args->context->instID[0];
+    RTCHitN_instPrimID(hit, N, i, 0) = args->context->instPrimID[0];
+
+    ctx.volume = v;
+    ctx.instID = args->context->instID[0];
+    ctx.instArrayID = args->context->instPrimID[0];
+    ctx.tExit = t1;
+  }
+}
+
+// Group definitions //////////////////////////////////////////////////////////
+
 Group::Group(HelideGlobalState *s)
     : Object(ANARI_GROUP, s), m_surfaceData(this), m_volumeData(this)
 {}
@@ -21,8 +91,10 @@ bool Group::getProperty(
 {
   if (name == "bounds" && type == ANARI_FLOAT32_BOX3) {
     if (flags & ANARI_WAIT) {
+      std::unique_lock<std::shared_mutex> lock(deviceState()->sceneMutex);
       embreeSceneConstruct();
       embreeSceneCommit();
+      reportSceneUpdates();
     }
     auto bounds = getEmbreeSceneBounds(m_embreeScene);
     for (auto *v : volumes()) {
@@ -40,6 +112,12 @@ void Group::commit()
 {
   cleanup();
 
+  m_bvhSettings = deviceState()->bvhDefaults;
+  if (!readEmbreeBVHSettings(*this, m_bvhSettings)) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "unknown 'bvhBuildQuality' on ANARIGroup, using device default");
+  }
+
   m_surfaceData = getParamObject<ObjectArray>("surface");
   m_volumeData = getParamObject<ObjectArray>("volume");
 
@@ -61,33 +139,6 @@ const std::vector<Volume *> &Group::volumes() const
   return m_volumes;
 }
 
-void Group::intersectVolumes(VolumeRay &ray) const
-{
-  Volume *originalVolume = ray.volume;
-  box1 t = ray.t;
-
-  for (auto *v : volumes()) {
-    if (!v->isValid())
-      continue;
-    const box3 bounds = v->bounds();
-    const float3 mins = (bounds.lower - ray.org) * (1.f / ray.dir);
-    const float3 maxs = (bounds.upper - ray.org) * (1.f / ray.dir);
-    const float3 nears = linalg::min(mins, maxs);
-    const float3 fars = linalg::max(mins, maxs);
-
-    const box1 lt(linalg::maxelem(nears), linalg::minelem(fars));
-
-    if (lt.lower < lt.upper && (!ray.volume || lt.lower < t.lower)) {
-      t.lower = clamp(lt.lower, t);
-      t.upper = clamp(lt.upper, t);
-      ray.volume = v;
-    }
-  }
-
-  if (ray.volume != originalVolume)
-    ray.t = t;
-}
-
 void Group::markCommitted()
 {
   Object::markCommitted();
@@ -100,18 +151,32 @@ RTCScene Group::embreeScene() const
   return m_embreeScene;
 }
 
-void Group::embreeSceneConstruct()
+RTCScene Group::embreeVolumeScene() const
+{
+  return m_embreeVolumeScene;
+}
+
+bool Group::embreeSceneConstruct()
 {
+  // Committing this group resets its construction time, otherwise it is only
+  // rebuilt when one of its surfaces or volumes changed what the BLS holds,
+  // or when a device parameter affected all groups
   const auto &state = *deviceState();
-  if (m_objectUpdates.lastSceneConstruction
-      > state.objectUpdates.lastBLSReconstructSceneRequest)
-    return;
+  const auto lastConstruction = m_objectUpdates.lastSceneConstruction;
+  if (lastConstruction > state.objectUpdates.lastBLSReconstructAllRequest
+      && !contentChangedSince(lastConstruction))
+    return false;
 
-  reportMessage(ANARI_SEVERITY_DEBUG, "helide::Group rebuilding embree scene");
+  m_sceneUpdateReport.constructed = true;
+  m_sceneUpdateReport.rejectedSurfaces.clear();
 
   rtcReleaseScene(m_embreeScene);
   m_embreeScene = rtcNewScene(deviceState()->embreeDevice);
+  setEmbreeSceneSettings(m_embreeScene, m_bvhSettings);
 
+  // Rebuilds requested for all groups do not go through cleanup(), and the
+  // surfaces' validity may have changed since the last build
+  m_surfaces.clear();
   if (m_surfaceData) {
     uint32_t id = 0;
     std::for_each(m_surfaceData->handlesBegin(),
@@ -123,42 +188,81 @@ void Group::embreeSceneConstruct()
             rtcAttachGeometryByID(
                 m_embreeScene, s->geometry()->embreeGeometry(), id++);
           } else {
-            reportMessage(ANARI_SEVERITY_DEBUG,
-                "helide::Group rejecting invalid surface(%p) in building BLS",
-                s);
-            auto *g = s->geometry();
-            if (!g || !g->isValid()) {
-              reportMessage(
-                  ANARI_SEVERITY_DEBUG, "    helide::Geometry is invalid");
-            }
-            auto *m = s->material();
-            if (!m || !m->isValid()) {
-              reportMessage(
-                  ANARI_SEVERITY_DEBUG, "    helide::Material is invalid");
-            }
+            m_sceneUpdateReport.rejectedSurfaces.push_back(s);
           }
         });
   }
 
+  rtcReleaseScene(m_embreeVolumeScene);
+  m_embreeVolumeScene = nullptr;
+
+  if (!m_volumes.empty()) {
+    auto device = deviceState()->embreeDevice;
+    m_embreeVolumeScene = rtcNewScene(device);
+    setEmbreeSceneSettings(m_embreeVolumeScene, m_bvhSettings);
+    auto geom = rtcNewGeometry(device, RTC_GEOMETRY_TYPE_USER);
+    rtcSetGeometryUserPrimitiveCount(geom, uint32_t(m_volumes.size()));
+    rtcSetGeometryUserData(geom, this);
+    rtcSetGeometryBoundsFunction(geom, volumeBounds, nullptr);
+    rtcSetGeometryIntersectFunction(geom, volumeIntersect);
+    rtcCommitGeometry(geom);
+    rtcAttachGeometry(m_embreeVolumeScene, geom);
+    rtcReleaseGeometry(geom);
+  }
+
   m_objectUpdates.lastSceneConstruction = helium::newTimeStamp();
   m_objectUpdates.lastSceneCommit = 0;
   embreeSceneCommit();
+  return true;
 }
 
 void Group::embreeSceneCommit()
 {
-  const auto &state = *deviceState();
   if (!m_embreeScene
-      || m_objectUpdates.lastSceneCommit
-          > state.objectUpdates.lastBLSCommitSceneRequest)
+      || (m_objectUpdates.lastSceneCommit != 0
+          && !geometryCommittedSince(m_objectUpdates.lastSceneCommit)))
     return;
 
-  reportMessage(ANARI_SEVERITY_DEBUG, "helide::Group committing embree scene");
+  m_sceneUpdateReport.committed = true;
 
   rtcCommitScene(m_embreeScene);
+  if (m_embreeVolumeScene)
+    rtcCommitScene(m_embreeVolumeScene);
   m_objectUpdates.lastSceneCommit = helium::newTimeStamp();
 }
 
+void Group::reportSceneUpdates()
+{
+  auto &report = m_sceneUpdateReport;
+
+  if (report.constructed) {
+    reportMessage(ANARI_SEVERITY_DEBUG,
+        "helide::Group rebuilding embree scene (%s)",
+        toString(m_bvhSettings).c_str());
+  }
+
+  for (auto *s : report.rejectedSurfaces) {
+    reportMessage(ANARI_SEVERITY_DEBUG,
+        "helide::Group rejecting invalid surface(%p) in building BLS",
+        s);
+    if (!s)
+      continue;
+    auto *g = s->geometry();
+    if (!g || !g->isValid())
+      reportMessage(ANARI_SEVERITY_DEBUG, "    helide::Geometry is invalid");
+    auto *m = s->material();
+    if (!m || !m->isValid())
+      reportMessage(ANARI_SEVERITY_DEBUG, "    helide::Material is invalid");
+  }
+
+  if (report.committed) {
+    reportMessage(
+        ANARI_SEVERITY_DEBUG, "helide::Group committing embree scene");
+  }
+
+  report = {};
+}
+
 void Group::cleanup()
 {
   m_surfaces.clear();
@@ -169,6 +273,28 @@ void Group::cleanup()
 
   rtcReleaseScene(m_embreeScene);
   m_embreeScene = nullptr;
+  rtcReleaseScene(m_embreeVolumeScene);
+  m_embreeVolumeScene = nullptr;
+}
+
+bool Group::geometryCommittedSince(helium::TimeStamp t) const
+{
+  return std::any_of(m_surfaces.begin(), m_surfaces.end(), [&](auto *s) {
+    return s->geometry()->lastCommitted() > t;
+  });
+}
+
+bool Group::contentChangedSince(helium::TimeStamp t) const
+{
+  // Rejected surfaces are not in m_surfaces but may have become valid since
+  auto changed = [&](auto *o) {
+    return o && ((Object *)o)->lastBLSChange() > t;
+  };
+  return (m_surfaceData
+             && std::any_of(m_surfaceData->handlesBegin(),
+                 m_surfaceData->handlesEnd(),
+                 changed))
+      || std::any_of(m_volumes.begin(), m_volumes.end(), changed);
 }
 
 box3 getEmbreeSceneBounds(RTCScene scene)
@@ -10,6 +10,18 @@
 
 namespace helide {
 
+// Context passed to Embree when tracing a ray through the volume scenes, the
+// groups' volume user geometry reports the closest volume entered in it
+struct VolumeRayQueryContext
+{
+  RTCRayQueryContext context; // must be first, Embree only knows about this
+  float tMax{std::numeric_limits<float>::max()};
+  Volume *volume{nullptr};
+  uint32_t instID{RTC_INVALID_GEOMETRY_ID};
+  uint32_t instArrayID{RTC_INVALID_GEOMETRY_ID};
+  float tExit{0.f};
+};
+
 struct Group : public Object
 {
   Group(HelideGlobalState *s);
@@ -25,16 +37,20 @@ struct Group : public Object
   const std::vector<Surface *> &surfaces() const;
   const std::vector<Volume *> &volumes() const;
 
-  void intersectVolumes(VolumeRay &ray) const;
-
   void markCommitted() override;
 
   RTCScene embreeScene() const;
-  void embreeSceneConstruct();
+  RTCScene embreeVolumeScene() const; // null if the group has no volumes
+  bool embreeSceneConstruct(); // returns false if the BLS was up to date
   void embreeSceneCommit();
+  // Construct/commit may run on Embree worker threads, so they only record
+  // what they did: report it from the calling thread once they are done
+  void reportSceneUpdates();
 
  private:
   void cleanup();
+  bool geometryCommittedSince(helium::TimeStamp t) const;
+  bool contentChangedSince(helium::TimeStamp t) const;
 
   // Geometry //
 
@@ -54,7 +70,16 @@ struct Group : public Object
     helium::TimeStamp lastSceneCommit{0};
   } m_objectUpdates;
 
+  struct SceneUpdateReport
+  {
+    bool constructed{false};
+    bool committed{false};
+    std::vector<Surface *> rejectedSurfaces;
+  } m_sceneUpdateReport;
+
+  EmbreeBVHSettings m_bvhSettings;
   RTCScene m_embreeScene{nullptr};
+  RTCScene m_embreeVolumeScene{nullptr};
 };
 
 box3 getEmbreeSceneBounds(RTCScene scene);
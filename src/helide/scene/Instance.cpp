@@ -6,19 +6,33 @@
 namespace helide {
 
 Instance::Instance(HelideGlobalState *s)
-    : Object(ANARI_INSTANCE, s), m_xfmArray(this), m_idArray(this)
+    : Object(ANARI_INSTANCE, s),
+      m_xfmArray(this),
+      m_idArray(this),
+      m_uniformAttrArrays{this, this, this, this, this}
 {
   m_embreeGeometry =
       rtcNewGeometry(s->embreeDevice, RTC_GEOMETRY_TYPE_INSTANCE_ARRAY);
+  m_embreeVolumeGeometry =
+      rtcNewGeometry(s->embreeDevice, RTC_GEOMETRY_TYPE_INSTANCE_ARRAY);
+
+  // Transform-only updates keep the TLS topology, let Embree refit them
+  rtcSetGeometryBuildQuality(m_embreeGeometry, RTC_BUILD_QUALITY_REFIT);
+  rtcSetGeometryBuildQuality(m_embreeVolumeGeometry, RTC_BUILD_QUALITY_REFIT);
 }
 
 Instance::~Instance()
 {
   rtcReleaseGeometry(m_embreeGeometry);
+  rtcReleaseGeometry(m_embreeVolumeGeometry);
 }
 
 void Instance::commit()
 {
+  const Group *lastGroup = m_group.ptr;
+  const uint32_t lastNumTransforms = numTransforms();
+  const bool wasValid = isValid();
+
   m_idArray = getParamObject<Array1D>("id");
   if (m_idArray && m_idArray->elementType() != ANARI_UINT32) {
     reportMessage(ANARI_SEVERITY_WARNING,
@@ -39,29 +53,27 @@ void Instance::commit()
   }
   m_xfm = getParam<mat4>("transform", mat4(linalg::identity));
 
+  const uint32_t n = numTransforms();
+  m_xfmInv.resize(n);
+  m_xfmInvRot.resize(n);
+  for (uint32_t i = 0; i < n; i++) {
+    m_xfmInv[i] = linalg::inverse(xfm(i));
+    m_xfmInvRot[i] = linalg::inverse(extractRotation(xfm(i)));
+  }
+
   m_group = getParamObject<Group>("group");
   if (!m_group)
     reportMessage(ANARI_SEVERITY_WARNING, "missing 'group' on ANARIInstance");
 
-  for (auto &a : m_uniformAttr)
-    a.reset();
-  float4 attrV = DEFAULT_ATTRIBUTE_VALUE;
-  if (getParam("attribute0", ANARI_FLOAT32_VEC4, &attrV))
-    m_uniformAttr[0] = attrV;
-  if (getParam("attribute1", ANARI_FLOAT32_VEC4, &attrV))
-    m_uniformAttr[1] = attrV;
-  if (getParam("attribute2", ANARI_FLOAT32_VEC4, &attrV))
-    m_uniformAttr[2] = attrV;
-  if (getParam("attribute3", ANARI_FLOAT32_VEC4, &attrV))
-    m_uniformAttr[3] = attrV;
-  if (getParam("color", ANARI_FLOAT32_VEC4, &attrV))
-    m_uniformAttr[4] = attrV;
-
-  m_uniformAttrArrays.attribute0 = getParamObject<Array1D>("attribute0");
-  m_uniformAttrArrays.attribute1 = getParamObject<Array1D>("attribute1");
-  m_uniformAttrArrays.attribute2 = getParamObject<Array1D>("attribute2");
-  m_uniformAttrArrays.attribute3 = getParamObject<Array1D>("attribute3");
-  m_uniformAttrArrays.color = getParamObject<Array1D>("color");
+  auto &arrays = m_uniformAttrArrays;
+  readUniformAttribute(Attribute::ATTRIBUTE_0, "attribute0", arrays.attribute0);
+  readUniformAttribute(Attribute::ATTRIBUTE_1, "attribute1", arrays.attribute1);
+  readUniformAttribute(Attribute::ATTRIBUTE_2, "attribute2", arrays.attribute2);
+  readUniformAttribute(Attribute::ATTRIBUTE_3, "attribute3", arrays.attribute3);
+  readUniformAttribute(Attribute::COLOR, "color", arrays.color);
+
+  m_needsTLSReconstruct = !wasValid || lastGroup != m_group.ptr
+      || lastNumTransforms != numTransforms();
 }
 
 uint32_t Instance::numTransforms() const
@@ -79,24 +91,6 @@ const mat4 &Instance::xfm(uint32_t i) const
   return m_xfmArray ? *m_xfmArray->valueAt<mat4>(i) : m_xfm;
 }
 
-UniformAttributeSet Instance::getUniformAttributes(uint32_t i) const
-{
-  UniformAttributeSet retval = m_uniformAttr;
-
-  if (m_uniformAttrArrays.attribute0)
-    retval[0] = m_uniformAttrArrays.attribute0->readAsAttributeValue(i);
-  if (m_uniformAttrArrays.attribute1)
-    retval[1] = m_uniformAttrArrays.attribute1->readAsAttributeValue(i);
-  if (m_uniformAttrArrays.attribute2)
-    retval[2] = m_uniformAttrArrays.attribute2->readAsAttributeValue(i);
-  if (m_uniformAttrArrays.attribute3)
-    retval[3] = m_uniformAttrArrays.attribute3->readAsAttributeValue(i);
-  if (m_uniformAttrArrays.color)
-    retval[4] = m_uniformAttrArrays.color->readAsAttributeValue(i);
-
-  return retval;
-}
-
 const Group *Instance::group() const
 {
   return m_group.ptr;
@@ -112,26 +106,57 @@ RTCGeometry Instance::embreeGeometry() const
   return m_embreeGeometry;
 }
 
+RTCGeometry Instance::embreeVolumeGeometry() const
+{
+  return m_embreeVolumeGeometry;
+}
+
 void Instance::embreeGeometryUpdate()
 {
-  rtcSetGeometryInstancedScene(m_embreeGeometry, group()->embreeScene());
-  auto *xfms = rtcSetNewGeometryBuffer(m_embreeGeometry,
-      RTC_BUFFER_TYPE_TRANSFORM,
-      0,
-      RTC_FORMAT_FLOAT4X4_COLUMN_MAJOR,
-      sizeof(mat4),
-      this->numTransforms());
-  std::memcpy(xfms,
-      m_xfmArray ? m_xfmArray->begin() : &m_xfm,
-      this->numTransforms() * sizeof(mat4));
-  rtcCommitGeometry(m_embreeGeometry);
+  auto update = [&](RTCGeometry geom, RTCScene scene) {
+    rtcSetGeometryInstancedScene(geom, scene);
+    auto *xfms = rtcSetNewGeometryBuffer(geom,
+        RTC_BUFFER_TYPE_TRANSFORM,
+        0,
+        RTC_FORMAT_FLOAT4X4_COLUMN_MAJOR,
+        sizeof(mat4),
+        this->numTransforms());
+    std::memcpy(xfms,
+        m_xfmArray ? m_xfmArray->begin() : &m_xfm,
+        this->numTransforms() * sizeof(mat4));
+    rtcCommitGeometry(geom);
+  };
+
+  update(m_embreeGeometry, group()->embreeScene());
+  if (auto volumeScene = group()->embreeVolumeScene(); volumeScene)
+    update(m_embreeVolumeGeometry, volumeScene);
+}
+
+void Instance::embreeTransformsUpdate()
+{
+  auto update = [&](RTCGeometry geom) {
+    auto *xfms = rtcGetGeometryBufferData(geom, RTC_BUFFER_TYPE_TRANSFORM, 0);
+    std::memcpy(xfms,
+        m_xfmArray ? m_xfmArray->begin() : &m_xfm,
+        this->numTransforms() * sizeof(mat4));
+    rtcUpdateGeometryBuffer(geom, RTC_BUFFER_TYPE_TRANSFORM, 0);
+    rtcCommitGeometry(geom);
+  };
+
+  if (!group()->surfaces().empty())
+    update(m_embreeGeometry);
+  if (group()->embreeVolumeScene())
+    update(m_embreeVolumeGeometry);
 }
 
 void Instance::markCommitted()
 {
   Object::markCommitted();
-  deviceState()->objectUpdates.lastTLSReconstructSceneRequest =
-      helium::newTimeStamp();
+  auto &updates = deviceState()->objectUpdates;
+  if (m_needsTLSReconstruct)
+    updates.lastTLSReconstructSceneRequest = helium::newTimeStamp();
+  else
+    updates.lastTLSCommitSceneRequest = helium::newTimeStamp();
 }
 
 bool Instance::isValid() const
@@ -139,6 +164,24 @@ bool Instance::isValid() const
   return m_group;
 }
 
+void Instance::readUniformAttribute(Attribute attr,
+    const char *name,
+    helium::ChangeObserverPtr<Array1D> &array)
+{
+  array = getParamObject<Array1D>(name);
+
+  auto &values = m_uniformAttr[static_cast<int>(attr)];
+  values.clear();
+
+  float4 v = DEFAULT_ATTRIBUTE_VALUE;
+  if (array) {
+    values.resize(array->size());
+    for (size_t i = 0; i < values.size(); i++)
+      values[i] = array->readAsAttributeValue(uint32_t(i));
+  } else if (getParam(name, ANARI_FLOAT32_VEC4, &v))
+    values.push_back(v);
+}
+
 } // namespace helide
 
 HELIDE_ANARI_TYPEFOR_DEFINITION(helide::Instance *);
@@ -17,49 +17,77 @@ struct Instance : public Object
   uint32_t numTransforms() const;
 
   const mat4 &xfm(uint32_t i = 0) const;
-  mat3 xfmInvRot(uint32_t i = 0) const;
+  const mat4 &xfmInv(uint32_t i = 0) const;
+  const mat3 &xfmInvRot(uint32_t i = 0) const;
 
   uint32_t id(uint32_t i = 0) const;
 
-  UniformAttributeSet getUniformAttributes(uint32_t i = 0) const;
+  InstanceAttributes uniformAttributes(uint32_t i = 0) const;
 
   const Group *group() const;
   Group *group();
 
   RTCGeometry embreeGeometry() const;
+  RTCGeometry embreeVolumeGeometry() const;
   void embreeGeometryUpdate();
+  void embreeTransformsUpdate();
 
   void markCommitted() override;
 
   bool isValid() const override;
 
  private:
+  void readUniformAttribute(Attribute attr,
+      const char *name,
+      helium::ChangeObserverPtr<Array1D> &array);
+
   mat4 m_xfm;
   helium::ChangeObserverPtr<Array1D> m_xfmArray;
 
+  // Inverses of each transform, computed on commit as shading and volume
+  // traversal need them for every hit
+  std::vector<mat4> m_xfmInv;
+  std::vector<mat3> m_xfmInvRot;
+
   uint32_t m_id{~0u};
   helium::ChangeObserverPtr<Array1D> m_idArray;
 
-  UniformAttributeSet m_uniformAttr;
+  // Attribute values are copied into the table on commit, observe the arrays
+  // they come from to refresh it when their data changes
+  UniformAttributeTable m_uniformAttr;
   struct UniformAttributeArrays
   {
-    helium::IntrusivePtr<Array1D> attribute0;
-    helium::IntrusivePtr<Array1D> attribute1;
-    helium::IntrusivePtr<Array1D> attribute2;
-    helium::IntrusivePtr<Array1D> attribute3;
-    helium::IntrusivePtr<Array1D> color;
+    helium::ChangeObserverPtr<Array1D> attribute0;
+    helium::ChangeObserverPtr<Array1D> attribute1;
+    helium::ChangeObserverPtr<Array1D> attribute2;
+    helium::ChangeObserverPtr<Array1D> attribute3;
+    helium::ChangeObserverPtr<Array1D> color;
   } m_uniformAttrArrays;
 
   helium::IntrusivePtr<Group> m_group;
 
+  // Set on commit when the TLS can't just be refit with the new transforms
+  bool m_needsTLSReconstruct{true};
+
   RTCGeometry m_embreeGeometry{nullptr};
+  RTCGeometry m_embreeVolumeGeometry{nullptr};
 };
 
 // Inlined definitions ////////////////////////////////////////////////////////
 
-inline mat3 Instance::xfmInvRot(uint32_t i) const
+inline InstanceAttributes Instance::uniformAttributes(uint32_t i) const
+{
+  return {&m_uniformAttr, i};
+}
+
+inline const mat4 &Instance::xfmInv(uint32_t i) const
+{
+  return m_xfmInv[i];
+}
+
+inline const mat3 &Instance::xfmInvRot(uint32_t i) const
 {
-  return linalg::inverse(extractRotation(xfm(i)));
+  return m_xfmInvRot[i];
 }
 
 } // namespace helide
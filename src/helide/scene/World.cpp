@@ -2,9 +2,53 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "World.h"
+// std
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+// embree
+#include "algorithms/parallel_for.h"
 
 namespace helide {
 
+// Helper functions ///////////////////////////////////////////////////////////
+
+static std::vector<Group *> uniqueGroups(const std::vector<Instance *> &insts)
+{
+  std::vector<Group *> groups;
+  groups.reserve(insts.size());
+  for (auto *inst : insts) {
+    if (auto *g = inst->group(); g)
+      groups.push_back(g);
+  }
+  std::sort(groups.begin(), groups.end());
+  groups.erase(std::unique(groups.begin(), groups.end()), groups.end());
+  return groups;
+}
+
+// Groups are independent of each other: build them as separate tasks, each
+// Embree commit is itself parallel when it nests into the same scheduler
+template <typename FCN>
+static void forEachGroup(const std::vector<Group *> &groups, FCN &&f)
+{
+  using Range = embree::range<size_t>;
+  embree::parallel_for(
+      size_t(0), groups.size(), size_t(1), [&](const Range &r) {
+        for (auto i = r.begin(); i < r.end(); i++)
+          f(groups[i]);
+      });
+}
+
+static RTCScene newTLSScene(
+    RTCDevice device, const EmbreeBVHSettings &settings)
+{
+  auto scene = rtcNewScene(device);
+  setEmbreeSceneSettings(scene, settings);
+  return scene;
+}
+
+// World definitions //////////////////////////////////////////////////////////
+
 World::World(HelideGlobalState *s)
     : Object(ANARI_WORLD, s),
       m_zeroSurfaceData(this),
@@ -29,8 +73,10 @@ bool World::getProperty(
     const std::string_view &name, ANARIDataType type, void *ptr, uint32_t flags)
 {
   if (name == "bounds" && type == ANARI_FLOAT32_BOX3) {
-    if (flags & ANARI_WAIT)
+    if (flags & ANARI_WAIT) {
+      std::unique_lock<std::shared_mutex> lock(deviceState()->sceneMutex);
       embreeSceneUpdate();
+    }
     auto bounds = getEmbreeSceneBounds(m_embreeScene);
     for (auto *i : instances()) {
       for (auto *v : i->group()->volumes()) {
@@ -49,6 +95,13 @@ void World::commit()
 {
   cleanup();
 
+  // TLSs are refit whenever instances move, favor fast builds over quality
+  m_bvhSettings = {RTC_BUILD_QUALITY_LOW, RTC_SCENE_FLAG_DYNAMIC};
+  if (!readEmbreeBVHSettings(*this, m_bvhSettings)) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "unknown 'bvhBuildQuality' on ANARIWorld, using 'low'");
+  }
+
   m_zeroSurfaceData = getParamObject<ObjectArray>("surface");
   m_zeroVolumeData = getParamObject<ObjectArray>("volume");
 
@@ -94,6 +147,7 @@ void World::commit()
     m_instances.push_back(m_zeroInstance.ptr);
 
   m_objectUpdates.lastTLSBuild = 0;
+  m_objectUpdates.lastTLSCommit = 0;
   m_objectUpdates.lastBLSReconstructCheck = 0;
   m_objectUpdates.lastBLSCommitCheck = 0;
 }
@@ -103,15 +157,54 @@ const std::vector<Instance *> &World::instances() const
   return m_instances;
 }
 
-void World::intersectVolumes(VolumeRay &ray) const
+bool World::intersectVolumes(VolumeRay &ray) const
 {
-  const auto &insts = instances();
-  for (uint32_t i = 0; i < insts.size(); i++) {
-    const auto *inst = insts[i];
-    inst->group()->intersectVolumes(ray);
-    if (ray.volume)
-      ray.instID = i;
-  }
+  if (!m_embreeVolumeScene)
+    return false;
+
+  VolumeRayQueryContext ctx;
+  rtcInitRayQueryContext(&ctx.context);
+  ctx.tMax = ray.t.upper;
+
+  RTCIntersectArguments args;
+  rtcInitIntersectArguments(&args);
+  args.context = &ctx.context;
+
+  RTCRayHit rh;
+  rh.ray.org_x = ray.org.x;
+  rh.ray.org_y = ray.org.y;
+  rh.ray.org_z = ray.org.z;
+  rh.ray.tnear = ray.t.lower;
+  rh.ray.dir_x = ray.dir.x;
+  rh.ray.dir_y = ray.dir.y;
+  rh.ray.dir_z = ray.dir.z;
+  rh.ray.time = 0.f;
+  rh.ray.tfar = ray.t.upper;
+  rh.ray.mask = ~0u;
+  rh.ray.id = 0;
+  rh.ray.flags = 0;
+  rh.hit.geomID = RTC_INVALID_GEOMETRY_ID;
+  rh.hit.instID[0] = RTC_INVALID_GEOMETRY_ID;
+
+  rtcIntersect1(m_embreeVolumeScene, &rh, &args);
+
+  if (!ctx.volume)
+    return true;
+
+  ray.volume = ctx.volume;
+  ray.instID = ctx.instID;
+  ray.instArrayID = ctx.instArrayID;
+  ray.t = box1(rh.ray.tfar, ctx.tExit);
+
+  // Volumes are sampled in object space, the ray parameterization (and thus
+  // the interval) is unchanged by the affine transform
+  const auto *inst = instances()[ray.instID];
+  const mat4 &inv = inst->xfmInv(ray.instArrayID);
+  const float4 org = linalg::mul(inv, float4(ray.org, 1.f));
+  const float4 dir = linalg::mul(inv, float4(ray.dir, 0.f));
+  ray.org = float3(org.x, org.y, org.z);
+  ray.dir = float3(dir.x, dir.y, dir.z);
+  return true;
 }
 
 RTCScene World::embreeScene() const
@@ -119,31 +212,61 @@ RTCScene World::embreeScene() const
   return m_embreeScene;
 }
 
-void World::embreeSceneUpdate()
+bool World::embreeSceneNeedsUpdate() const
 {
-  rebuildBLSs();
+  const auto &state = *deviceState();
+  return state.objectUpdates.lastBLSReconstructSceneRequest
+      >= m_objectUpdates.lastBLSReconstructCheck
+      || state.objectUpdates.lastBLSCommitSceneRequest
+      >= m_objectUpdates.lastBLSCommitCheck
+      || state.objectUpdates.lastTLSReconstructSceneRequest
+      >= m_objectUpdates.lastTLSBuild
+      || state.objectUpdates.lastTLSCommitSceneRequest
+      >= m_objectUpdates.lastTLSCommit;
+}
+
+SceneUpdateStats World::embreeSceneUpdate()
+{
+  using clock = std::chrono::steady_clock;
+  SceneUpdateStats stats;
+
+  const auto start = clock::now();
+  stats.blsRebuilds = rebuildBLSs();
   recommitBLSs();
+  const auto blsEnd = clock::now();
   rebuildTLS();
+  refitTLS();
+  const auto tlsEnd = clock::now();
+
+  stats.blsBuildTime = std::chrono::duration<float>(blsEnd - start).count();
+  stats.tlsBuildTime = std::chrono::duration<float>(tlsEnd - blsEnd).count();
+  return stats;
 }
 
-void World::rebuildBLSs()
+uint32_t World::rebuildBLSs()
 {
   const auto &state = *deviceState();
   if (state.objectUpdates.lastBLSReconstructSceneRequest
       < m_objectUpdates.lastBLSReconstructCheck) {
-    return;
+    return 0;
   }
 
   m_objectUpdates.lastTLSBuild = 0; // BLS changed, so need to build TLS
+  const auto groups = uniqueGroups(m_instances);
   reportMessage(ANARI_SEVERITY_DEBUG,
-      "helide::World rebuilding %zu BLSs",
-      m_instances.size());
-  std::for_each(m_instances.begin(), m_instances.end(), [&](auto *inst) {
-    inst->group()->embreeSceneConstruct();
+      "helide::World rebuilding BLSs of %zu groups",
+      groups.size());
+  std::atomic<uint32_t> numRebuilt{0};
+  forEachGroup(groups, [&](Group *g) {
+    if (g->embreeSceneConstruct())
+      numRebuilt++;
   });
+  for (auto *g : groups)
+    g->reportSceneUpdates();
 
   m_objectUpdates.lastBLSReconstructCheck = helium::newTimeStamp();
   m_objectUpdates.lastBLSCommitCheck = helium::newTimeStamp();
+  return numRebuilt;
 }
 
 void World::recommitBLSs()
@@ -155,12 +278,13 @@ void World::recommitBLSs()
   }
 
   m_objectUpdates.lastTLSBuild = 0; // BLS changed, so need to build TLS
+  const auto groups = uniqueGroups(m_instances);
   reportMessage(ANARI_SEVERITY_DEBUG,
-      "helide::World recommitting %zu BLSs",
-      m_instances.size());
-  std::for_each(m_instances.begin(), m_instances.end(), [&](auto *inst) {
-    inst->group()->embreeSceneCommit();
-  });
+      "helide::World recommitting BLSs of %zu groups",
+      groups.size());
+  forEachGroup(groups, [](Group *g) { g->embreeSceneCommit(); });
+  for (auto *g : groups)
+    g->reportSceneUpdates();
 
   m_objectUpdates.lastBLSCommitCheck = helium::newTimeStamp();
 }
@@ -174,41 +298,87 @@ void World::rebuildTLS()
   }
 
   reportMessage(ANARI_SEVERITY_DEBUG,
-      "helide::World rebuilding TLS over %zu instances",
-      m_instances.size());
+      "helide::World rebuilding TLS over %zu instances (%s)",
+      m_instances.size(),
+      toString(m_bvhSettings).c_str());
 
+  auto device = deviceState()->embreeDevice;
   rtcReleaseScene(m_embreeScene);
-  m_embreeScene = rtcNewScene(deviceState()->embreeDevice);
+  m_embreeScene = newTLSScene(device, m_bvhSettings);
+  rtcReleaseScene(m_embreeVolumeScene);
+  m_embreeVolumeScene = newTLSScene(device, m_bvhSettings);
 
   uint32_t id = 0;
   std::for_each(m_instances.begin(), m_instances.end(), [&](auto *i) {
-    if (i && i->isValid() && !i->group()->surfaces().empty()) {
+    if (!i || !i->isValid()) {
+      reportMessage(ANARI_SEVERITY_DEBUG,
+          "helide::World rejecting invalid instance(%p) when building TLS",
+          i);
+      id++;
+      return;
+    }
+
+    const bool hasSurfaces = !i->group()->surfaces().empty();
+    const bool hasVolumes = i->group()->embreeVolumeScene() != nullptr;
+
+    if (hasSurfaces || hasVolumes)
       i->embreeGeometryUpdate();
+
+    if (hasSurfaces)
       rtcAttachGeometryByID(m_embreeScene, i->embreeGeometry(), id);
-    } else {
-      if (i->group()->surfaces().empty()) {
-        reportMessage(ANARI_SEVERITY_DEBUG,
-            "helide::World rejecting empty surfaces in instance(%p) "
-            "when building TLS",
-            i);
-      } else {
-        reportMessage(ANARI_SEVERITY_DEBUG,
-            "helide::World rejecting invalid surfaces in instance(%p) "
-            "when building TLS",
-            i);
-      }
+    else {
+      reportMessage(ANARI_SEVERITY_DEBUG,
+          "helide::World rejecting empty surfaces in instance(%p) "
+          "when building TLS",
+          i);
     }
+
+    if (hasVolumes)
+      rtcAttachGeometryByID(m_embreeVolumeScene, i->embreeVolumeGeometry(), id);
+
     id++;
   });
 
   rtcCommitScene(m_embreeScene);
+  rtcCommitScene(m_embreeVolumeScene);
   m_objectUpdates.lastTLSBuild = helium::newTimeStamp();
+  m_objectUpdates.lastTLSCommit = m_objectUpdates.lastTLSBuild;
+}
+
+void World::refitTLS()
+{
+  const auto &state = *deviceState();
+  if (state.objectUpdates.lastTLSCommitSceneRequest
+      < m_objectUpdates.lastTLSCommit) {
+    return;
+  }
+
+  // Only transforms changed since the last TLS build: update them in place
+  // and let Embree refit the existing scenes
+  size_t numUpdated = 0;
+  for (auto *i : m_instances) {
+    if (i && i->isValid()
+        && i->lastCommitted() >= m_objectUpdates.lastTLSCommit) {
+      i->embreeTransformsUpdate();
+      numUpdated++;
+    }
+  }
+
+  reportMessage(ANARI_SEVERITY_DEBUG,
+      "helide::World refitting TLS over %zu updated instances",
+      numUpdated);
+
+  rtcCommitScene(m_embreeScene);
+  rtcCommitScene(m_embreeVolumeScene);
+  m_objectUpdates.lastTLSCommit = helium::newTimeStamp();
 }
 
 void World::cleanup()
 {
   rtcReleaseScene(m_embreeScene);
   m_embreeScene = nullptr;
+  rtcReleaseScene(m_embreeVolumeScene);
+  m_embreeVolumeScene = nullptr;
 }
 
 } // namespace helide
@@ -7,6 +7,14 @@
 
 namespace helide {
 
+// What World::embreeSceneUpdate() did, times are in seconds
+struct SceneUpdateStats
+{
+  float blsBuildTime{0.f};
+  float tlsBuildTime{0.f};
+  uint32_t blsRebuilds{0};
+};
+
 struct World : public Object
 {
   World(HelideGlobalState *s);
@@ -21,19 +29,22 @@ struct World : public Object
 
   const std::vector<Instance *> &instances() const;
 
-  void intersectVolumes(VolumeRay &ray) const;
+  // Returns false if there was no volume scene to trace the ray against
+  bool intersectVolumes(VolumeRay &ray) const;
 
   const Instance *instanceFromRay(const Ray &ray) const;
   const Instance *instanceFromRay(const VolumeRay &ray) const;
   const Surface *surfaceFromRay(const Ray &ray) const;
 
   RTCScene embreeScene() const;
-  void embreeSceneUpdate();
+  bool embreeSceneNeedsUpdate() const;
+  SceneUpdateStats embreeSceneUpdate();
 
  private:
-  void rebuildBLSs();
+  uint32_t rebuildBLSs(); // returns the number of rebuilt BLSs
   void recommitBLSs();
   void rebuildTLS();
+  void refitTLS();
   void cleanup();
 
   helium::ChangeObserverPtr<ObjectArray> m_zeroSurfaceData;
@@ -53,11 +64,15 @@ struct World : public Object
   struct ObjectUpdates
   {
     helium::TimeStamp lastTLSBuild{0};
+    helium::TimeStamp lastTLSCommit{0};
     helium::TimeStamp lastBLSReconstructCheck{0};
     helium::TimeStamp lastBLSCommitCheck{0};
   } m_objectUpdates;
 
+  EmbreeBVHSettings m_bvhSettings;
+
   RTCScene m_embreeScene{nullptr};
+  RTCScene m_embreeVolumeScene{nullptr};
 };
 
 // Inlined definitions ////////////////////////////////////////////////////////
@@ -10,10 +10,18 @@ Surface::Surface(HelideGlobalState *s) : Object(ANARI_SURFACE, s) {}
 
 void Surface::commit()
 {
+  const auto *lastGeometry = m_geometry.ptr;
+  const bool wasValid = isValid();
+
   m_id = getParam<uint32_t>("id", ~0u);
   m_geometry = getParamObject<Geometry>("geometry");
   m_material = getParamObject<Material>("material");
 
+  // Material changes are picked up at shading time, only adding, removing or
+  // replacing the Embree geometry requires the groups to rebuild their BLS
+  m_needsBLSReconstruct =
+      wasValid != isValid() || lastGeometry != m_geometry.ptr;
+
   if (!m_material) {
     reportMessage(ANARI_SEVERITY_WARNING, "missing 'material' on ANARISurface");
     return;
@@ -36,7 +44,7 @@ const Material *Surface::material() const
 }
 
 float4 Surface::getSurfaceColor(
-    const Ray &ray, const UniformAttributeSet &instAttrV) const
+    const Ray &ray, const InstanceAttributes &instAttr) const
 {
   const auto &state = *deviceState();
   const auto &imc = state.invalidMaterialColor;
@@ -50,17 +58,17 @@ float4 Surface::getSurfaceColor(
   const auto *colorSampler = mat->colorSampler();
 
   if (colorSampler && colorSampler->isValid())
-    return colorSampler->getSample(*geometry(), ray, instAttrV);
+    return colorSampler->getSample(*geometry(), ray, instAttr);
   else if (colorAttribute == Attribute::NONE)
     return mat->color();
-  else if (const auto &ia = getUniformAttribute(instAttrV, colorAttribute); ia)
+  else if (const auto *ia = instAttr.get(colorAttribute); ia)
     return *ia;
   else
     return geometry()->getAttributeValue(colorAttribute, ray);
 }
 
 float Surface::getSurfaceOpacity(
-    const Ray &ray, const UniformAttributeSet &instAttrV) const
+    const Ray &ray, const InstanceAttributes &instAttr) const
 {
   auto &state = *deviceState();
   auto &imc = state.invalidMaterialColor;
@@ -74,11 +82,10 @@ float Surface::getSurfaceOpacity(
   const auto *opacitySampler = mat->opacitySampler();
 
   if (opacitySampler && opacitySampler->isValid())
-    return opacitySampler->getSample(*geometry(), ray, instAttrV).x;
+    return opacitySampler->getSample(*geometry(), ray, instAttr).x;
   else if (opacityAttribute == Attribute::NONE)
     return mat->opacity();
-  else if (const auto &ia = getUniformAttribute(instAttrV, opacityAttribute);
-           ia)
+  else if (const auto *ia = instAttr.get(opacityAttribute); ia)
     return ia->x;
   else
     return geometry()->getAttributeValue(opacityAttribute, ray).x;
@@ -87,8 +94,8 @@ float Surface::getSurfaceOpacity(
 void Surface::markCommitted()
 {
   Object::markCommitted();
-  deviceState()->objectUpdates.lastBLSReconstructSceneRequest =
-      helium::newTimeStamp();
+  if (m_needsBLSReconstruct)
+    markBLSChanged();
 }
 
 bool Surface::isValid() const
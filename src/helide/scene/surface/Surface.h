@@ -22,9 +22,9 @@ struct Surface : public Object
   const Material *material() const;
 
   float4 getSurfaceColor(
-      const Ray &ray, const UniformAttributeSet &instAttrV) const;
+      const Ray &ray, const InstanceAttributes &instAttr) const;
   float getSurfaceOpacity(
-      const Ray &ray, const UniformAttributeSet &instAttrV) const;
+      const Ray &ray, const InstanceAttributes &instAttr) const;
 
   float adjustedAlpha(float a) const;
 
@@ -35,6 +35,7 @@ struct Surface : public Object
   uint32_t m_id{~0u};
   helium::IntrusivePtr<Geometry> m_geometry;
   helium::IntrusivePtr<Material> m_material;
+  bool m_needsBLSReconstruct{true};
 };
 
 // Inlined definitions ////////////////////////////////////////////////////////
@@ -2,8 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "Cone.h"
-// std
-#include <numeric>
+// embree
+#include "algorithms/parallel_for.h"
 
 namespace helide {
 
@@ -33,14 +33,29 @@ void Cone::commit()
     return;
   }
 
-  const float *radius =
-      m_vertexRadius ? m_vertexRadius->beginAs<float>() : nullptr;
   m_globalRadius = getParam<float>("radius", 1.f);
 
   const auto numCones =
       m_index ? m_index->size() : m_vertexPosition->size() / 2;
 
-  {
+  if (!m_index && !m_vertexRadius
+      && m_vertexPosition->elementType() == ANARI_FLOAT32_VEC4) {
+    // Without 'vertex.radius', which takes precedence over the w component,
+    // vertices already are position + radius pairs: let Embree read them
+    rtcSetSharedGeometryBuffer(embreeGeometry(),
+        RTC_BUFFER_TYPE_VERTEX,
+        0,
+        RTC_FORMAT_FLOAT4,
+        m_vertexPosition->beginAs<float4>(),
+        0,
+        sizeof(float4),
+        numCones * 2);
+    m_packedVertices.reset();
+  } else if (m_packedVertices.update(
+                 {m_index.get(), m_vertexPosition.get(), m_vertexRadius.get()},
+                 PositionRadiusReader::usedGlobalRadius(*m_vertexPosition,
+                     m_vertexRadius.get(),
+                     m_globalRadius))) {
     auto *vr = (float4 *)rtcSetNewGeometryBuffer(embreeGeometry(),
         RTC_BUFFER_TYPE_VERTEX,
         0,
@@ -48,36 +63,33 @@ void Cone::commit()
         sizeof(float4),
         numCones * 2);
 
-    if (m_index) {
-      const auto *begin = m_index->beginAs<uint2>();
-      const auto *end = m_index->endAs<uint2>();
-      const auto *v = m_vertexPosition->beginAs<float3>();
-      uint32_t cID = 0;
-      std::for_each(begin, end, [&](const uint2 &idx) {
-        vr[cID + 0] = float4(v[idx.x], radius ? radius[idx.x] : m_globalRadius);
-        vr[cID + 1] = float4(v[idx.y], radius ? radius[idx.y] : m_globalRadius);
-        cID += 2;
-      });
-    } else {
-      const auto *begin = m_vertexPosition->beginAs<float3>();
-      const auto *end = m_vertexPosition->endAs<float3>();
-      uint32_t rID = 0;
-      std::transform(begin, end, vr, [&](const float3 &v) {
-        return float4(v, radius ? radius[rID++] : m_globalRadius);
-      });
-    }
+    const PositionRadiusReader vertex(
+        *m_vertexPosition, m_vertexRadius.get(), m_globalRadius);
+    const auto *index = m_index ? m_index->beginAs<uint2>() : nullptr;
+
+    using Range = embree::range<size_t>;
+    embree::parallel_for(size_t(0),
+        numCones,
+        PACKING_GRAIN_SIZE,
+        [&](const Range &r) {
+          for (auto c = r.begin(); c < r.end(); c++) {
+            const uint2 idx = index ? index[c] : uint2(c * 2, c * 2 + 1);
+            vr[c * 2 + 0] = vertex(idx.x);
+            vr[c * 2 + 1] = vertex(idx.y);
+          }
+        });
   }
 
-  {
-    auto *idx = (uint32_t *)rtcSetNewGeometryBuffer(embreeGeometry(),
-        RTC_BUFFER_TYPE_INDEX,
-        0,
-        RTC_FORMAT_UINT,
-        sizeof(uint32_t),
-        numCones);
-    std::iota(idx, idx + numCones, 0);
-    std::transform(idx, idx + numCones, idx, [](auto &i) { return i * 2; });
-  }
+  // Each cone has its own pair of vertices, so cone 'i' starts at vertex 2i:
+  // read every other entry of the shared identity index buffer
+  rtcSetGeometryBuffer(embreeGeometry(),
+      RTC_BUFFER_TYPE_INDEX,
+      0,
+      RTC_FORMAT_UINT,
+      deviceState()->identityIndexBuffer(numCones * 2),
+      0,
+      sizeof(uint2),
+      numCones);
 
   rtcCommitGeometry(embreeGeometry());
 }
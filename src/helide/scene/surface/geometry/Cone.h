@@ -22,6 +22,7 @@ struct Cone : public Geometry
   helium::ChangeObserverPtr<Array1D> m_vertexRadius;
   std::array<helium::IntrusivePtr<Array1D>, 5> m_vertexAttributes;
   float m_globalRadius{0.f};
+  PackedBufferSources m_packedVertices;
 };
 
 } // namespace helide
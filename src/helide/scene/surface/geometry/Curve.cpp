@@ -2,8 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "Curve.h"
-// std
-#include <numeric>
+// embree
+#include "algorithms/parallel_for.h"
 
 namespace helide {
 
@@ -33,27 +33,48 @@ void Curve::commit()
     return;
   }
 
-  const float *radius =
-      m_vertexRadius ? m_vertexRadius->beginAs<float>() : nullptr;
   m_globalRadius = getParam<float>("radius", 1.f);
 
   const auto numSegments =
       m_index ? m_index->size() : m_vertexPosition->size() / 2;
+  const auto numVertices = m_vertexPosition->size();
 
-  {
+  if (!m_vertexRadius
+      && m_vertexPosition->elementType() == ANARI_FLOAT32_VEC4) {
+    // Without 'vertex.radius', which takes precedence over the w component,
+    // vertices already are position + radius pairs: let Embree read them
+    rtcSetSharedGeometryBuffer(embreeGeometry(),
+        RTC_BUFFER_TYPE_VERTEX,
+        0,
+        RTC_FORMAT_FLOAT4,
+        m_vertexPosition->beginAs<float4>(),
+        0,
+        sizeof(float4),
+        numVertices);
+    m_packedVertices.reset();
+  } else if (m_packedVertices.update(
+                 {m_vertexPosition.get(), m_vertexRadius.get()},
+                 PositionRadiusReader::usedGlobalRadius(*m_vertexPosition,
+                     m_vertexRadius.get(),
+                     m_globalRadius))) {
     auto *vr = (float4 *)rtcSetNewGeometryBuffer(embreeGeometry(),
         RTC_BUFFER_TYPE_VERTEX,
         0,
         RTC_FORMAT_FLOAT4,
         sizeof(float4),
-        m_vertexPosition->size());
-
-    const auto *begin = m_vertexPosition->beginAs<float3>();
-    const auto *end = m_vertexPosition->endAs<float3>();
-    uint32_t rID = 0;
-    std::transform(begin, end, vr, [&](const float3 &v) {
-      return float4(v, radius ? radius[rID++] : m_globalRadius);
-    });
+        numVertices);
+
+    const PositionRadiusReader vertex(
+        *m_vertexPosition, m_vertexRadius.get(), m_globalRadius);
+
+    using Range = embree::range<size_t>;
+    embree::parallel_for(size_t(0),
+        numVertices,
+        PACKING_GRAIN_SIZE,
+        [&](const Range &r) {
+          for (auto i = r.begin(); i < r.end(); i++)
+            vr[i] = vertex(i);
+        });
   }
 
   if (m_index) {
@@ -66,13 +87,14 @@ void Curve::commit()
         sizeof(uint32_t),
         numSegments);
   } else {
-    auto *idx = (uint32_t *)rtcSetNewGeometryBuffer(embreeGeometry(),
+    rtcSetGeometryBuffer(embreeGeometry(),
         RTC_BUFFER_TYPE_INDEX,
         0,
         RTC_FORMAT_UINT,
+        deviceState()->identityIndexBuffer(numSegments),
+        0,
         sizeof(uint32_t),
         numSegments);
-    std::iota(idx, idx + numSegments, 0);
   }
 
   rtcCommitGeometry(embreeGeometry());
@@ -2,8 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "Cylinder.h"
-// std
-#include <numeric>
+// embree
+#include "algorithms/parallel_for.h"
 
 namespace helide {
 
@@ -33,13 +33,16 @@ void Cylinder::commit()
     return;
   }
 
-  const float *radius = m_radius ? m_radius->beginAs<float>() : nullptr;
   m_globalRadius = getParam<float>("radius", 1.f);
 
   const auto numCylinders =
       m_index ? m_index->size() : m_vertexPosition->size() / 2;
 
-  {
+  // Radii are per cylinder, so vertices are always packed with them (the w
+  // component of FLOAT32_VEC4 positions is ignored)
+  if (m_packedVertices.update(
+          {m_index.get(), m_vertexPosition.get(), m_radius.get()},
+          m_radius ? 0.f : m_globalRadius)) {
     auto *vr = (float4 *)rtcSetNewGeometryBuffer(embreeGeometry(),
         RTC_BUFFER_TYPE_VERTEX,
         0,
@@ -47,38 +50,34 @@ void Cylinder::commit()
         sizeof(float4),
         numCylinders * 2);
 
-    if (m_index) {
-      const auto *begin = m_index->beginAs<uint2>();
-      const auto *end = m_index->endAs<uint2>();
-      const auto *v = m_vertexPosition->beginAs<float3>();
-      uint32_t cID = 0;
-      std::for_each(begin, end, [&](const uint2 &idx) {
-        vr[cID + 0] =
-            float4(v[idx.x], radius ? radius[cID / 2] : m_globalRadius);
-        vr[cID + 1] =
-            float4(v[idx.y], radius ? radius[cID / 2] : m_globalRadius);
-        cID += 2;
-      });
-    } else {
-      const auto *begin = m_vertexPosition->beginAs<float3>();
-      const auto *end = m_vertexPosition->endAs<float3>();
-      uint32_t rID = 0;
-      std::transform(begin, end, vr, [&](const float3 &v) {
-        return float4(v, radius ? radius[rID++ / 2] : m_globalRadius);
-      });
-    }
+    const PositionRadiusReader vertex(*m_vertexPosition, nullptr, 0.f);
+    const auto *index = m_index ? m_index->beginAs<uint2>() : nullptr;
+    const float *radius = m_radius ? m_radius->beginAs<float>() : nullptr;
+
+    using Range = embree::range<size_t>;
+    embree::parallel_for(size_t(0),
+        numCylinders,
+        PACKING_GRAIN_SIZE,
+        [&](const Range &r) {
+          for (auto c = r.begin(); c < r.end(); c++) {
+            const uint2 idx = index ? index[c] : uint2(c * 2, c * 2 + 1);
+            const float cr = radius ? radius[c] : m_globalRadius;
+            vr[c * 2 + 0] = float4(vertex(idx.x).xyz(), cr);
+            vr[c * 2 + 1] = float4(vertex(idx.y).xyz(), cr);
+          }
+        });
   }
 
-  {
-    auto *idx = (uint32_t *)rtcSetNewGeometryBuffer(embreeGeometry(),
-        RTC_BUFFER_TYPE_INDEX,
-        0,
-        RTC_FORMAT_UINT,
-        sizeof(uint32_t),
-        numCylinders);
-    std::iota(idx, idx + numCylinders, 0);
-    std::transform(idx, idx + numCylinders, idx, [](auto &i) { return i * 2; });
-  }
+  // Each cylinder has its own pair of vertices, so cylinder 'i' starts at
+  // vertex 2i: read every other entry of the shared identity index buffer
+  rtcSetGeometryBuffer(embreeGeometry(),
+      RTC_BUFFER_TYPE_INDEX,
+      0,
+      RTC_FORMAT_UINT,
+      deviceState()->identityIndexBuffer(numCylinders * 2),
+      0,
+      sizeof(uint2),
+      numCylinders);
 
   rtcCommitGeometry(embreeGeometry());
 }
@@ -10,11 +10,58 @@
 #include "Sphere.h"
 #include "Triangle.h"
 // std
+#include <cassert>
 #include <cstring>
 #include <limits>
 
 namespace helide {
 
+// PackedBufferSources definitions ////////////////////////////////////////////
+
+bool PackedBufferSources::update(
+    std::initializer_list<const Array1D *> arrays, float value)
+{
+  assert(arrays.size() <= MAX_ARRAYS);
+
+  bool changed = m_lastPacked == 0 || value != m_value;
+  size_t i = 0;
+  for (auto *a : arrays) {
+    // Privatizing an array moves its data without marking it modified
+    const void *data = a ? a->data() : nullptr;
+    changed = changed || a != m_arrays[i] || data != m_data[i]
+        || (a && a->lastDataModified() > m_lastPacked);
+    m_arrays[i] = a;
+    m_data[i] = data;
+    i++;
+  }
+
+  m_value = value;
+  if (changed)
+    m_lastPacked = helium::newTimeStamp();
+
+  return changed;
+}
+
+void PackedBufferSources::reset()
+{
+  m_lastPacked = 0;
+}
+
+// PositionRadiusReader definitions ///////////////////////////////////////////
+
+PositionRadiusReader::PositionRadiusReader(
+    const Array1D &positions, const Array1D *radii, float globalRadius)
+    : m_radii(radii ? radii->beginAs<float>() : nullptr),
+      m_globalRadius(globalRadius)
+{
+  if (positions.elementType() == ANARI_FLOAT32_VEC4)
+    m_interleaved = positions.beginAs<float4>();
+  else
+    m_positions = positions.beginAs<float3>();
+}
+
+// Geometry definitions ///////////////////////////////////////////////////////
+
 Geometry::Geometry(HelideGlobalState *s) : Object(ANARI_GEOMETRY, s) {}
 
 Geometry::~Geometry()
@@ -48,6 +95,11 @@ RTCGeometry Geometry::embreeGeometry() const
 
 void Geometry::commit()
 {
+  if (m_embreeGeometry) {
+    rtcSetGeometryBuildQuality(
+        m_embreeGeometry, deviceState()->bvhDefaults.buildQuality);
+  }
+
   for (auto &a : m_uniformAttr)
     a.reset();
   float4 attrV = DEFAULT_ATTRIBUTE_VALUE;
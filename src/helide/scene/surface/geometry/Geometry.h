@@ -5,9 +5,50 @@
 
 #include "Object.h"
 #include "array/Array1D.h"
+// std
+#include <initializer_list>
 
 namespace helide {
 
+// Number of primitives or vertices packed per task into Embree buffers
+constexpr size_t PACKING_GRAIN_SIZE = 4096;
+
+// Identifies the arrays (and versions of their data) an Embree buffer was last
+// packed from, so commits only changing unrelated parameters skip repacking
+struct PackedBufferSources
+{
+  // Returns true if the buffer must be repacked, recording the new sources
+  bool update(std::initializer_list<const Array1D *> arrays, float value);
+  void reset();
+
+ private:
+  static constexpr size_t MAX_ARRAYS = 3;
+  std::array<const Array1D *, MAX_ARRAYS> m_arrays{};
+  std::array<const void *, MAX_ARRAYS> m_data{};
+  helium::TimeStamp m_lastPacked{0};
+  float m_value{0.f};
+};
+
+// Reads vertex positions with a radius in w. Radii come from the radius array
+// when given, else from the w of FLOAT32_VEC4 positions or the global radius
+struct PositionRadiusReader
+{
+  PositionRadiusReader(
+      const Array1D &positions, const Array1D *radii, float globalRadius);
+  float4 operator()(size_t i) const;
+
+  // The global radius if vertices read it, else 0 so that changing it does
+  // not cause a repack (see PackedBufferSources)
+  static float usedGlobalRadius(
+      const Array1D &positions, const Array1D *radii, float globalRadius);
+
+ private:
+  const float3 *m_positions{nullptr};
+  const float4 *m_interleaved{nullptr};
+  const float *m_radii{nullptr};
+  float m_globalRadius{0.f};
+};
+
 struct Geometry : public Object
 {
   Geometry(HelideGlobalState *s);
@@ -34,6 +75,23 @@ struct Geometry : public Object
 
 // Inlined definitions ////////////////////////////////////////////////////////
 
+inline float4 PositionRadiusReader::operator()(size_t i) const
+{
+  if (m_interleaved && !m_radii)
+    return m_interleaved[i];
+  const float3 p = m_interleaved
+      ? float3(m_interleaved[i].x, m_interleaved[i].y, m_interleaved[i].z)
+      : m_positions[i];
+  return float4(p, m_radii ? m_radii[i] : m_globalRadius);
+}
+
+inline float PositionRadiusReader::usedGlobalRadius(
+    const Array1D &positions, const Array1D *radii, float globalRadius)
+{
+  const bool interleaved = positions.elementType() == ANARI_FLOAT32_VEC4;
+  return radii || interleaved ? 0.f : globalRadius;
+}
+
 inline uint32_t Geometry::getPrimID(const Ray &ray) const
 {
   if (m_primitiveId) {
@@ -2,8 +2,6 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "Quad.h"
-// std
-#include <numeric>
 
 namespace helide {
 
@@ -50,14 +48,17 @@ void Quad::commit()
         sizeof(uint4),
         m_index->size());
   } else {
+    // Non-indexed primitives use consecutive vertices, share one index buffer
+    // with all other such geometries instead of filling one for each
     const auto numQuads = m_vertexPosition->size() / 4;
-    auto *vr = (uint32_t *)rtcSetNewGeometryBuffer(embreeGeometry(),
+    rtcSetGeometryBuffer(embreeGeometry(),
         RTC_BUFFER_TYPE_INDEX,
         0,
         RTC_FORMAT_UINT4,
+        deviceState()->identityIndexBuffer(numQuads * 4),
+        0,
         sizeof(uint4),
         numQuads);
-    std::iota(vr, vr + (numQuads * 4), 0);
   }
 
   rtcCommitGeometry(embreeGeometry());
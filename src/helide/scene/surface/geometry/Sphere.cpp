@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "Sphere.h"
+// embree
+#include "algorithms/parallel_for.h"
 
 namespace helide {
 
@@ -33,44 +35,54 @@ void Sphere::commit()
 
   m_globalRadius = getParam<float>("radius", 0.01f);
 
-  const float *radius = nullptr;
-  if (m_vertexRadius)
-    radius = m_vertexRadius->beginAs<float>();
-
   const auto numSpheres = m_index ? m_index->size() : m_vertexPosition->size();
 
-  auto *vr = (float4 *)rtcSetNewGeometryBuffer(embreeGeometry(),
-      RTC_BUFFER_TYPE_VERTEX,
-      0,
-      RTC_FORMAT_FLOAT4,
-      sizeof(float4),
-      numSpheres);
-
-  m_attributeIndex.clear();
-
-  if (m_index) {
-    m_attributeIndex.reserve(m_index->size());
-
-    const auto *begin = m_index->beginAs<uint32_t>();
-    const auto *end = m_index->endAs<uint32_t>();
-    const auto *vertices = m_vertexPosition->beginAs<float3>();
-
-    size_t sphereID = 0;
-    std::transform(begin, end, vr, [&](uint32_t i) {
-      m_attributeIndex.push_back(i);
-      const auto &v = vertices[i];
-      const float r = radius ? radius[i] : m_globalRadius;
-      return float4(v.x, v.y, v.z, r);
-    });
-  } else {
-    const auto *begin = m_vertexPosition->beginAs<float3>();
-    const auto *end = m_vertexPosition->endAs<float3>();
-
-    size_t sphereID = 0;
-    std::transform(begin, end, vr, [&](const float3 &v) {
-      const float r = radius ? radius[sphereID++] : m_globalRadius;
-      return float4(v.x, v.y, v.z, r);
-    });
+  if (!m_index && !m_vertexRadius
+      && m_vertexPosition->elementType() == ANARI_FLOAT32_VEC4) {
+    // Without 'vertex.radius', which takes precedence over the w component,
+    // vertices already are position + radius pairs: let Embree read them
+    rtcSetSharedGeometryBuffer(embreeGeometry(),
+        RTC_BUFFER_TYPE_VERTEX,
+        0,
+        RTC_FORMAT_FLOAT4,
+        m_vertexPosition->beginAs<float4>(),
+        0,
+        sizeof(float4),
+        numSpheres);
+    m_attributeIndex.clear();
+    m_packedVertices.reset();
+  } else if (m_packedVertices.update(
+                 {m_index.get(), m_vertexPosition.get(), m_vertexRadius.get()},
+                 PositionRadiusReader::usedGlobalRadius(*m_vertexPosition,
+                     m_vertexRadius.get(),
+                     m_globalRadius))) {
+    auto *vr = (float4 *)rtcSetNewGeometryBuffer(embreeGeometry(),
+        RTC_BUFFER_TYPE_VERTEX,
+        0,
+        RTC_FORMAT_FLOAT4,
+        sizeof(float4),
+        numSpheres);
+
+    const PositionRadiusReader vertex(
+        *m_vertexPosition, m_vertexRadius.get(), m_globalRadius);
+    const auto *index = m_index ? m_index->beginAs<uint32_t>() : nullptr;
+
+    m_attributeIndex.clear();
+    if (index)
+      m_attributeIndex.resize(numSpheres);
+
+    using Range = embree::range<size_t>;
+    embree::parallel_for(size_t(0),
+        numSpheres,
+        PACKING_GRAIN_SIZE,
+        [&](const Range &r) {
+          for (auto i = r.begin(); i < r.end(); i++) {
+            const uint32_t vi = index ? index[i] : uint32_t(i);
+            if (index)
+              m_attributeIndex[i] = vi;
+            vr[i] = vertex(vi);
+          }
+        });
   }
 
   rtcCommitGeometry(embreeGeometry());
@@ -23,6 +23,7 @@ struct Sphere : public Geometry
   std::array<helium::IntrusivePtr<Array1D>, 5> m_vertexAttributes;
   std::vector<uint32_t> m_attributeIndex;
   float m_globalRadius{0.f};
+  PackedBufferSources m_packedVertices;
 };
 
 } // namespace helide
@@ -2,8 +2,6 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "Triangle.h"
-// std
-#include <numeric>
 
 namespace helide {
 
@@ -51,14 +49,17 @@ void Triangle::commit()
         sizeof(uint3),
         m_index->size());
   } else {
+    // Non-indexed primitives use consecutive vertices, share one index buffer
+    // with all other such geometries instead of filling one for each
     const auto numTris = m_vertexPosition->size() / 3;
-    auto *vr = (uint32_t *)rtcSetNewGeometryBuffer(embreeGeometry(),
+    rtcSetGeometryBuffer(embreeGeometry(),
         RTC_BUFFER_TYPE_INDEX,
         0,
         RTC_FORMAT_UINT3,
+        deviceState()->identityIndexBuffer(numTris * 3),
+        0,
         sizeof(uint3),
         numTris);
-    std::iota(vr, vr + (numTris * 3), 0);
   }
 
   rtcCommitGeometry(embreeGeometry());
@@ -17,7 +17,7 @@ struct Image2D : public Sampler
 
   float4 getSample(const Geometry &g,
       const Ray &r,
-      const UniformAttributeSet &instAttrV) const override;
+      const InstanceAttributes &instAttr) const override;
 
  private:
   helium::IntrusivePtr<Array2D> m_image;
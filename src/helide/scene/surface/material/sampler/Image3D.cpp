@@ -28,12 +28,12 @@ void Image3D::commit()
 }
 
 float4 Image3D::getSample(
-    const Geometry &g, const Ray &r, const UniformAttributeSet &instAttrV) const
+    const Geometry &g, const Ray &r, const InstanceAttributes &instAttr) const
 {
   if (m_inAttribute == Attribute::NONE)
     return DEFAULT_ATTRIBUTE_VALUE;
 
-  const auto &ia = getUniformAttribute(instAttrV, m_inAttribute);
+  const auto *ia = instAttr.get(m_inAttribute);
   auto av = linalg::mul(
                 m_inTransform, ia ? *ia : g.getAttributeValue(m_inAttribute, r))
       + m_inOffset;
@@ -23,7 +23,7 @@ void PrimitiveSampler::commit()
 
 float4 PrimitiveSampler::getSample(const Geometry &g,
     const Ray &r,
-    const UniformAttributeSet & /*instAttrV*/) const
+    const InstanceAttributes & /*instAttr*/) const
 {
   return m_array->readAsAttributeValue(uint32_t(r.primID + m_offset));
 }
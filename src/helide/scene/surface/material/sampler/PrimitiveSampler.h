@@ -17,7 +17,7 @@ struct PrimitiveSampler : public Sampler
 
   float4 getSample(const Geometry &g,
       const Ray &r,
-      const UniformAttributeSet &instAttrV) const override;
+      const InstanceAttributes &instAttr) const override;
 
  private:
   helium::IntrusivePtr<Array1D> m_array;
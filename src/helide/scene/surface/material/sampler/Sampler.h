@@ -16,7 +16,7 @@ struct Sampler : public Object
 
   virtual float4 getSample(const Geometry &g,
       const Ray &r,
-      const UniformAttributeSet &instAttrV) const = 0;
+      const InstanceAttributes &instAttr) const = 0;
 
   static Sampler *createInstance(
       std::string_view subtype, HelideGlobalState *d);
@@ -22,12 +22,12 @@ void TransformSampler::commit()
 }
 
 float4 TransformSampler::getSample(
-    const Geometry &g, const Ray &r, const UniformAttributeSet &instAttrV) const
+    const Geometry &g, const Ray &r, const InstanceAttributes &instAttr) const
 {
   if (m_inAttribute == Attribute::NONE)
     return DEFAULT_ATTRIBUTE_VALUE;
 
-  const auto &ia = getUniformAttribute(instAttrV, m_inAttribute);
+  const auto *ia = instAttr.get(m_inAttribute);
   return linalg::mul(
       m_transform, ia ? *ia : g.getAttributeValue(m_inAttribute, r));
 }
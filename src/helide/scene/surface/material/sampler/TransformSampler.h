@@ -16,7 +16,7 @@ struct TransformSampler : public Sampler
 
   float4 getSample(const Geometry &g,
       const Ray &r,
-      const UniformAttributeSet &instAttrV) const override;
+      const InstanceAttributes &instAttr) const override;
 
  private:
   Attribute m_inAttribute{Attribute::NONE};
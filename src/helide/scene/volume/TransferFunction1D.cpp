@@ -2,9 +2,31 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "TransferFunction1D.h"
+// std
+#include <cmath>
+#include <limits>
 
 namespace helide {
 
+// Number of entries in the baked transfer function
+constexpr size_t LUT_SIZE = 1024;
+
+// Pre-integrated segments stay smooth over larger distances, so march at
+// this multiple of the field's step size when pre-integration is enabled
+constexpr float PRE_INTEGRATION_STEP_SCALE = 2.f;
+
+// Clamp for opacities before converting them to extinction
+constexpr float MAX_OPACITY = 0.9999f;
+
+// Helper functions ///////////////////////////////////////////////////////////
+
+static float correctOpacity(float opacity, float stepScale)
+{
+  return 1.f - std::pow(1.f - std::min(opacity, MAX_OPACITY), stepScale);
+}
+
+// TransferFunction1D definitions /////////////////////////////////////////////
+
 TransferFunction1D::TransferFunction1D(HelideGlobalState *d)
     : Volume(d), m_field(this)
 {}
@@ -28,6 +50,7 @@ void TransferFunction1D::commit()
   m_colorData = getParamObject<Array1D>("color");
   m_opacityData = getParamObject<Array1D>("opacity");
   m_densityScale = getParam<float>("densityScale", 1.f);
+  m_preIntegration = getParam<bool>("preIntegration", false);
 
   if (!m_colorData) {
     reportMessage(ANARI_SEVERITY_WARNING,
@@ -39,6 +62,9 @@ void TransferFunction1D::commit()
         "no opacity data provided to transfer function");
     return;
   }
+
+  updateLookupTables();
+  updateMajorants();
 }
 
 bool TransferFunction1D::isValid() const
@@ -51,27 +77,170 @@ box3 TransferFunction1D::bounds() const
   return m_field->bounds();
 }
 
-void TransferFunction1D::render(
+uint32_t TransferFunction1D::render(
     const VolumeRay &vray, float3 &color, float &opacity)
 {
-  const float stepSize = field()->stepSize();
+  const float stepScale = vray.stepScale
+      * (m_preIntegration ? PRE_INTEGRATION_STEP_SCALE : 1.f);
+  const float stepSize = field()->stepSize() * stepScale;
   const float jitter = 1.f; // NOTE: use uniform rng if/when lower sampling rate
-  box1 currentInterval = vray.t;
-  currentInterval.lower += stepSize * jitter;
-
-  while (opacity < 0.99f && size(currentInterval) >= 0.f) {
-    const float3 p = vray.org + vray.dir * currentInterval.lower;
-    const float s = field()->sampleAt(p);
-
-    if (!std::isnan(s)) {
-      const float3 c = colorOf(s);
-      const float o = opacityOf(s) * m_densityScale;
-      accumulateValue(color, c * o, opacity);
-      accumulateValue(opacity, o, opacity);
+  const float tEnd = vray.t.upper;
+  float t = vray.t.lower + stepSize * jitter;
+  float prevSample = NAN;
+  uint32_t numSamples = 0;
+
+  auto integrate = [&](float tStop) {
+    for (; opacity < 0.99f && t <= tStop; t += stepSize) {
+      const float3 p = vray.org + vray.dir * t;
+      const float s = field()->sampleAt(p);
+      numSamples++;
+
+      if (!std::isnan(s)) {
+        float4 v;
+        if (m_preIntegration)
+          v = preIntegratedValueOf(prevSample, s, stepScale);
+        else {
+          v = valueOf(s);
+          if (stepScale != 1.f)
+            v.w = correctOpacity(v.w, stepScale);
+        }
+        const float3 c(v.x, v.y, v.z);
+        const float o = v.w;
+        accumulateValue(color, c * o, opacity);
+        accumulateValue(opacity, o, opacity);
+      }
+
+      prevSample = s;
     }
+  };
+
+  const auto &grid = field()->macrocells();
+  if (m_majorants.empty()) {
+    integrate(tEnd);
+    return numSamples;
+  }
+
+  // 3D-DDA through the macrocells, cells with a zero majorant are skipped
+  // while keeping samples on the same positions along the ray
+  const float inf = std::numeric_limits<float>::infinity();
+  const float3 org = (vray.org - grid.origin) / grid.cellSize;
+  const float3 dir = vray.dir / grid.cellSize;
+  const int3 dims(grid.dims);
+
+  const float3 p = org + dir * t;
+  int3 cell = linalg::clamp(int3(linalg::floor(p)), int3(0), dims - 1);
+  int3 step;
+  float3 tNext;
+  float3 tDelta;
+  for (int i = 0; i < 3; i++) {
+    step[i] = dir[i] < 0.f ? -1 : 1;
+    tDelta[i] = dir[i] != 0.f ? std::abs(1.f / dir[i]) : inf;
+    const float boundary = float(cell[i] + (step[i] > 0 ? 1 : 0));
+    tNext[i] = dir[i] != 0.f ? t + (boundary - p[i]) / dir[i] : inf;
+  }
+
+  while (opacity < 0.99f && t <= tEnd) {
+    const float tExit = std::min(linalg::minelem(tNext), tEnd);
+    if (majorantOf(cell) > 0.f)
+      integrate(tExit);
+    else if (t <= tExit) {
+      t += (std::floor((tExit - t) / stepSize) + 1.f) * stepSize;
+      prevSample = NAN;
+    }
+
+    const int axis = linalg::argmin(tNext);
+    cell[axis] += step[axis];
+    if (cell[axis] < 0 || cell[axis] >= dims[axis])
+      break;
+    tNext[axis] += tDelta[axis];
+  }
+
+  return numSamples;
+}
 
-    currentInterval.lower += stepSize;
+float4 TransferFunction1D::preIntegratedValueOf(
+    float front, float back, float stepScale) const
+{
+  const float last = float(m_lut.size() - 1);
+  const float x0 = std::isnan(front) ? NAN : normalized(front) * last;
+  const float x1 = normalized(back) * last;
+
+  // Short segments (or no previous sample) fall back to the LUT value with
+  // its opacity corrected for the larger step size
+  if (!(std::abs(x1 - x0) >= 1.f)) {
+    const float4 v = valueOf(back);
+    return float4(v.x, v.y, v.z, correctOpacity(v.w, stepScale));
+  }
+
+  const float4 avg = (integralAt(x1) - integralAt(x0)) / (x1 - x0);
+  const float3 color =
+      avg.w > 0.f ? float3(avg.x, avg.y, avg.z) / avg.w : float3(0.f);
+  return float4(color, 1.f - std::exp(-avg.w * stepScale));
+}
+
+float TransferFunction1D::maxOpacityOf(const box1 &valueRange) const
+{
+  // Opacity is linearly interpolated, so its maximum over a value range is
+  // bounded by the control points surrounding that range
+  const size_t n = m_opacityData->size();
+  const float *opacities = m_opacityData->dataAs<float>();
+  const float last = float(n - 1);
+  const auto begin = size_t(std::floor(normalized(valueRange.lower) * last));
+  const auto end = size_t(std::ceil(normalized(valueRange.upper) * last));
+
+  float maxOpacity = 0.f;
+  for (size_t i = begin; i <= std::min(end, n - 1); i++)
+    maxOpacity = std::max(maxOpacity, opacities[i]);
+  return maxOpacity;
+}
+
+void TransferFunction1D::updateLookupTables()
+{
+  // Stay just below 1 so the last entry does not read past the arrays
+  const float maxPosition = std::nextafter(1.f, 0.f);
+  m_lut.resize(LUT_SIZE);
+  for (size_t i = 0; i < LUT_SIZE; i++) {
+    const float u = std::min(i / float(LUT_SIZE - 1), maxPosition);
+    const auto c = m_colorData->valueAtLinear<float3>(u);
+    const auto o = m_opacityData->valueAtLinear<float>(u) * m_densityScale;
+    m_lut[i] = float4(c, o);
   }
+
+  m_preIntegrationLut.clear();
+  if (!m_preIntegration)
+    return;
+
+  auto extinctionOf = [](const float4 &v) {
+    const float tau = -std::log(1.f - std::clamp(v.w, 0.f, MAX_OPACITY));
+    return float4(v.x * tau, v.y * tau, v.z * tau, tau);
+  };
+
+  // Trapezoidal running sum, in units of LUT entries
+  m_preIntegrationLut.resize(LUT_SIZE);
+  m_preIntegrationLut[0] = float4(0.f);
+  float4 prev = extinctionOf(m_lut[0]);
+  for (size_t i = 1; i < LUT_SIZE; i++) {
+    const float4 cur = extinctionOf(m_lut[i]);
+    m_preIntegrationLut[i] = m_preIntegrationLut[i - 1] + 0.5f * (prev + cur);
+    prev = cur;
+  }
+}
+
+void TransferFunction1D::updateMajorants()
+{
+  m_majorants.clear();
+
+  const auto &grid = field()->macrocells();
+  if (grid.valueRanges.empty() || m_opacityData->size() == 0)
+    return;
+
+  m_majorants.resize(grid.valueRanges.size());
+  std::transform(grid.valueRanges.begin(),
+      grid.valueRanges.end(),
+      m_majorants.begin(),
+      [&](const box1 &r) {
+        return r.lower > r.upper ? 0.f : maxOpacityOf(r) * m_densityScale;
+      });
 }
 
 } // namespace helide
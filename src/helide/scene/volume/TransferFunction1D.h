@@ -20,13 +20,20 @@ struct TransferFunction1D : public Volume
 
   box3 bounds() const override;
 
-  void render(const VolumeRay &vray,
+  uint32_t render(const VolumeRay &vray,
       float3 &outputColor,
       float &outputOpacity) override;
 
  private:
-  float3 colorOf(float sample) const;
-  float opacityOf(float sample) const;
+  float4 valueOf(float sample) const;
+  float4 preIntegratedValueOf(float front, float back, float stepScale) const;
+  float4 integralAt(float x) const;
+  float maxOpacityOf(const box1 &valueRange) const;
+
+  void updateLookupTables();
+
+  void updateMajorants();
+  float majorantOf(const int3 &cell) const;
 
   const SpatialField *field() const;
 
@@ -42,6 +49,17 @@ struct TransferFunction1D : public Volume
 
   helium::IntrusivePtr<Array1D> m_colorData;
   helium::IntrusivePtr<Array1D> m_opacityData;
+
+  // Color and opacity (with density scale applied) baked at fixed resolution
+  std::vector<float4> m_lut;
+
+  // Running integrals of the extinction (w) and of the extinction weighted
+  // colors (xyz) over the LUT, used to pre-integrate ray segments
+  bool m_preIntegration{false};
+  std::vector<float4> m_preIntegrationLut;
+
+  // Upper bound of the opacity in each macrocell of the field
+  std::vector<float> m_majorants;
 };
 
 // Inlined defintions /////////////////////////////////////////////////////////
@@ -51,14 +69,25 @@ inline const SpatialField *TransferFunction1D::field() const
   return m_field.get();
 }
 
-inline float3 TransferFunction1D::colorOf(float sample) const
+inline float4 TransferFunction1D::valueOf(float sample) const
+{
+  const float x = normalized(sample) * (m_lut.size() - 1);
+  const size_t i = std::min(size_t(x), m_lut.size() - 2);
+  return linalg::lerp(m_lut[i], m_lut[i + 1], x - i);
+}
+
+inline float4 TransferFunction1D::integralAt(float x) const
 {
-  return m_colorData->valueAtLinear<float3>(normalized(sample));
+  const auto &lut = m_preIntegrationLut;
+  const size_t i = std::min(size_t(x), lut.size() - 2);
+  return linalg::lerp(lut[i], lut[i + 1], x - i);
 }
 
-inline float TransferFunction1D::opacityOf(float sample) const
+inline float TransferFunction1D::majorantOf(const int3 &cell) const
 {
-  return m_opacityData->valueAtLinear<float>(normalized(sample));
+  const auto &dims = field()->macrocells().dims;
+  return m_majorants[size_t(cell.x)
+      + dims.x * (size_t(cell.y) + dims.y * size_t(cell.z))];
 }
 
 inline float TransferFunction1D::normalized(float sample) const
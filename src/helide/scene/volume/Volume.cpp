@@ -22,6 +22,23 @@ void Volume::commit()
   m_id = getParam<uint32_t>("id", ~0u);
 }
 
+void Volume::markCommitted()
+{
+  Object::markCommitted();
+
+  // Groups only hold volume bounds in their BLS, so transfer function edits
+  // which keep validity and bounds unchanged do not need to rebuild it
+  const bool valid = isValid();
+  const box3 b = valid ? bounds() : box3{};
+  const bool boundsChanged =
+      b.lower != m_lastBounds.lower || b.upper != m_lastBounds.upper;
+  if (valid != m_wasValid || boundsChanged)
+    markBLSChanged();
+
+  m_wasValid = valid;
+  m_lastBounds = b;
+}
+
 } // namespace helide
 
 HELIDE_ANARI_TYPEFOR_DEFINITION(helide::Volume *);
@@ -14,15 +14,19 @@ struct Volume : public Object
   static Volume *createInstance(std::string_view subtype, HelideGlobalState *d);
 
   void commit() override;
+  void markCommitted() override;
 
   uint32_t id() const;
 
   virtual box3 bounds() const = 0;
-  virtual void render(
+  // Returns the number of samples taken along the ray
+  virtual uint32_t render(
       const VolumeRay &vray, float3 &outputColor, float &outputOpacity) = 0;
 
   private:
   uint32_t m_id{~0u};
+  bool m_wasValid{false}; // validity and bounds groups last saw
+  box3 m_lastBounds;
 };
 
 // Inlined definitions ////////////////////////////////////////////////////////
@@ -25,6 +25,11 @@ void SpatialField::setStepSize(float size)
   m_stepSize = size;
 }
 
+void SpatialField::setMacrocells(MacrocellGrid &&grid)
+{
+  m_macrocells = std::move(grid);
+}
+
 } // namespace helide
 
 HELIDE_ANARI_TYPEFOR_DEFINITION(helide::SpatialField *);
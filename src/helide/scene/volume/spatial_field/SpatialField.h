@@ -4,9 +4,21 @@
 #pragma once
 
 #include "Object.h"
+// std
+#include <vector>
 
 namespace helide {
 
+// Coarse grid over a field storing the range of values found in each cell,
+// used by volumes to skip space which maps to zero opacity
+struct MacrocellGrid
+{
+  uint3 dims{0u};
+  float3 origin{0.f};
+  float3 cellSize{1.f};
+  std::vector<box1> valueRanges;
+};
+
 struct SpatialField : public Object
 {
   SpatialField(HelideGlobalState *d);
@@ -20,11 +32,16 @@ struct SpatialField : public Object
 
   float stepSize() const;
 
+  // Empty if the field does not provide one
+  const MacrocellGrid &macrocells() const;
+
  protected:
   void setStepSize(float size);
+  void setMacrocells(MacrocellGrid &&grid);
 
  private:
   float m_stepSize{0.f};
+  MacrocellGrid m_macrocells;
 };
 
 // Inlined definitions ////////////////////////////////////////////////////////
@@ -34,6 +51,11 @@ inline float SpatialField::stepSize() const
   return m_stepSize;
 }
 
+inline const MacrocellGrid &SpatialField::macrocells() const
+{
+  return m_macrocells;
+}
+
 } // namespace helide
 
 HELIDE_ANARI_TYPEFOR_SPECIALIZATION(
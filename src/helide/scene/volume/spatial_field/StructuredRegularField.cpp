@@ -3,12 +3,35 @@
 
 #include "StructuredRegularField.h"
 // std
+#include <cstring>
 #include <limits>
+#include <type_traits>
+// embree
+#include "algorithms/parallel_for.h"
 
 namespace helide {
 
+// Width of a macrocell in voxel cells
+constexpr uint32_t MACROCELL_SIZE = 16;
+
+// Width of a brick in voxels, must match brickedIndex()
+constexpr uint32_t BRICK_SIZE = 8;
+
+// Helper functions ///////////////////////////////////////////////////////////
+
+template <typename T>
+static float voxelToFloat(T v)
+{
+  if constexpr (std::is_integral_v<T>)
+    return v / float(std::numeric_limits<T>::max());
+  else
+    return float(v);
+}
+
+// StructuredRegularField definitions /////////////////////////////////////////
+
 StructuredRegularField::StructuredRegularField(HelideGlobalState *d)
-    : SpatialField(d)
+    : SpatialField(d), m_dataArray(this)
 {}
 
 void StructuredRegularField::commit()
@@ -34,6 +57,45 @@ void StructuredRegularField::commit()
       std::nextafter(m_dims.z - 1, 0));
 
   setStepSize(linalg::minelem(m_spacing / 2.f));
+
+  const auto layout = getParamString("dataLayout", "linear");
+  const bool bricked = layout == "bricked";
+  if (!bricked && layout != "linear") {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "unknown dataLayout '%s' on 'structuredRegular' field, using 'linear'",
+        layout.c_str());
+  }
+
+  m_brickedData.clear();
+  m_sampler = nullptr;
+
+  switch (m_type) {
+  case ANARI_FLOAT32:
+    setupSampler<float>(bricked);
+    break;
+  case ANARI_FLOAT64:
+    setupSampler<double>(bricked);
+    break;
+  case ANARI_UFIXED8:
+    setupSampler<uint8_t>(bricked);
+    break;
+  case ANARI_UFIXED16:
+    setupSampler<uint16_t>(bricked);
+    break;
+  case ANARI_FIXED16:
+    setupSampler<int16_t>(bricked);
+    break;
+  default:
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "unsupported element type %s on 'structuredRegular' field",
+        anari::toString(m_type));
+    setMacrocells({});
+    break;
+  }
+
+  // Volumes derive per-cell opacity bounds from the macrocells, make sure they
+  // see updated ones when only the field (or its data) changed
+  notifyChangeObservers();
 }
 
 bool StructuredRegularField::isValid() const
@@ -45,8 +107,8 @@ float StructuredRegularField::sampleAt(const float3 &coord) const
 {
   const float3 local = objectToLocal(coord);
 
-  if (local.x < 0.f || local.x > m_dims.x - 1.f || local.y < 0.f
-      || local.y > m_dims.y - 1.f || local.z < 0.f
+  if (!m_sampler || local.x < 0.f || local.x > m_dims.x - 1.f
+      || local.y < 0.f || local.y > m_dims.y - 1.f || local.z < 0.f
       || local.z > m_dims.z - 1.f) {
     return NAN;
   }
@@ -54,19 +116,54 @@ float StructuredRegularField::sampleAt(const float3 &coord) const
   const float3 clampedLocal =
       linalg::clamp(local, float3(0.f), m_coordUpperBound);
 
-  const uint3 vi0 = uint3(clampedLocal);
+  return (this->*m_sampler)(clampedLocal);
+}
+
+box3 StructuredRegularField::bounds() const
+{
+  return isValid()
+      ? box3(m_origin, m_origin + ((float3(m_dims) - 1.f) * m_spacing))
+      : box3{};
+}
+
+float3 StructuredRegularField::objectToLocal(const float3 &object) const
+{
+  return 1.f / (m_spacing) * (object - m_origin);
+}
+
+template <typename T, bool BRICKED>
+float StructuredRegularField::valueAtVoxel(const uint3 &index) const
+{
+  if constexpr (BRICKED) {
+    const T *data = (const T *)m_brickedData.data();
+    return voxelToFloat(data[brickedIndex(index)]);
+  } else {
+    const size_t i = size_t(index.x)
+        + m_dims.x * (size_t(index.y) + m_dims.y * size_t(index.z));
+    return voxelToFloat(((const T *)m_data)[i]);
+  }
+}
+
+template <typename T, bool BRICKED>
+float StructuredRegularField::sampleVoxels(const float3 &local) const
+{
+  const uint3 vi0 = uint3(local);
   const uint3 vi1 = linalg::clamp(vi0 + 1, uint3(0u), m_dims - 1);
 
-  const float3 fracLocal = clampedLocal - float3(vi0);
+  const float3 fracLocal = local - float3(vi0);
+
+  auto voxel = [&](uint32_t x, uint32_t y, uint32_t z) {
+    return valueAtVoxel<T, BRICKED>(uint3(x, y, z));
+  };
 
-  const float voxel_000 = valueAtVoxel(uint3(vi0.x, vi0.y, vi0.z));
-  const float voxel_001 = valueAtVoxel(uint3(vi1.x, vi0.y, vi0.z));
-  const float voxel_010 = valueAtVoxel(uint3(vi0.x, vi1.y, vi0.z));
-  const float voxel_011 = valueAtVoxel(uint3(vi1.x, vi1.y, vi0.z));
-  const float voxel_100 = valueAtVoxel(uint3(vi0.x, vi0.y, vi1.z));
-  const float voxel_101 = valueAtVoxel(uint3(vi1.x, vi0.y, vi1.z));
-  const float voxel_110 = valueAtVoxel(uint3(vi0.x, vi1.y, vi1.z));
-  const float voxel_111 = valueAtVoxel(uint3(vi1.x, vi1.y, vi1.z));
+  const float voxel_000 = voxel(vi0.x, vi0.y, vi0.z);
+  const float voxel_001 = voxel(vi1.x, vi0.y, vi0.z);
+  const float voxel_010 = voxel(vi0.x, vi1.y, vi0.z);
+  const float voxel_011 = voxel(vi1.x, vi1.y, vi0.z);
+  const float voxel_100 = voxel(vi0.x, vi0.y, vi1.z);
+  const float voxel_101 = voxel(vi1.x, vi0.y, vi1.z);
+  const float voxel_110 = voxel(vi0.x, vi1.y, vi1.z);
+  const float voxel_111 = voxel(vi1.x, vi1.y, vi1.z);
 
   const float voxel_00 = linalg::lerp(voxel_000, voxel_001, fracLocal.x);
   const float voxel_01 = linalg::lerp(voxel_010, voxel_011, fracLocal.x);
@@ -78,40 +175,99 @@ float StructuredRegularField::sampleAt(const float3 &coord) const
   return linalg::lerp(voxel_0, voxel_1, fracLocal.z);
 }
 
-box3 StructuredRegularField::bounds() const
+template <typename T>
+void StructuredRegularField::brickData()
 {
-  return isValid()
-      ? box3(m_origin, m_origin + ((float3(m_dims) - 1.f) * m_spacing))
-      : box3{};
+  m_numBricks = (m_dims + BRICK_SIZE - 1u) / BRICK_SIZE;
+  const size_t numBricks =
+      size_t(m_numBricks.x) * m_numBricks.y * m_numBricks.z;
+  const size_t brickVoxels = BRICK_SIZE * BRICK_SIZE * BRICK_SIZE;
+
+  // Voxels of partial bricks beyond the volume are never read, but zero them
+  // so the copy is deterministic
+  m_brickedData.resize(numBricks * brickVoxels * sizeof(T));
+  T *bricks = (T *)m_brickedData.data();
+  const T *data = (const T *)m_data;
+
+  using Range = embree::range<size_t>;
+  embree::parallel_for(size_t(0), numBricks, size_t(1), [&](const Range &r) {
+    for (auto b = r.begin(); b < r.end(); b++) {
+      T *brick = bricks + b * brickVoxels;
+      std::memset(brick, 0, brickVoxels * sizeof(T));
+
+      const uint3 brickID(b % m_numBricks.x,
+          (b / m_numBricks.x) % m_numBricks.y,
+          b / (size_t(m_numBricks.x) * m_numBricks.y));
+      const uint3 begin = brickID * BRICK_SIZE;
+      const uint3 end = linalg::min(begin + BRICK_SIZE, m_dims);
+      const uint32_t rowWidth = end.x - begin.x;
+
+      for (uint32_t z = begin.z; z < end.z; z++) {
+        for (uint32_t y = begin.y; y < end.y; y++) {
+          const size_t src =
+              begin.x + m_dims.x * (size_t(y) + m_dims.y * size_t(z));
+          const size_t dst = brickedIndex(uint3(begin.x, y, z));
+          std::memcpy(bricks + dst, data + src, rowWidth * sizeof(T));
+        }
+      }
+    }
+  });
 }
 
-float3 StructuredRegularField::objectToLocal(const float3 &object) const
+template <typename T>
+void StructuredRegularField::buildMacrocells()
 {
-  return 1.f / (m_spacing) * (object - m_origin);
+  const uint3 cells = linalg::max(m_dims, uint3(2u)) - 1u;
+
+  MacrocellGrid grid;
+  grid.dims = (cells + MACROCELL_SIZE - 1u) / MACROCELL_SIZE;
+  grid.origin = m_origin;
+  grid.cellSize = m_spacing * float(MACROCELL_SIZE);
+  grid.valueRanges.resize(size_t(grid.dims.x) * grid.dims.y * grid.dims.z);
+
+  // Each macrocell includes the voxels on its upper faces, which are shared
+  // with its neighbors, so that interpolated samples are always bounded
+  using Range = embree::range<size_t>;
+  embree::parallel_for(size_t(0),
+      grid.valueRanges.size(),
+      size_t(1),
+      [&](const Range &r) {
+        for (auto i = r.begin(); i < r.end(); i++) {
+          const uint3 mc(i % grid.dims.x,
+              (i / grid.dims.x) % grid.dims.y,
+              i / (size_t(grid.dims.x) * grid.dims.y));
+          const uint3 begin = mc * MACROCELL_SIZE;
+          const uint3 end = linalg::min(begin + MACROCELL_SIZE + 1u, m_dims);
+
+          box1 range;
+          for (uint32_t z = begin.z; z < end.z; z++) {
+            for (uint32_t y = begin.y; y < end.y; y++) {
+              for (uint32_t x = begin.x; x < end.x; x++) {
+                const float v = valueAtVoxel<T, false>(uint3(x, y, z));
+                if (std::isnan(v))
+                  continue;
+                range.lower = std::min(range.lower, v);
+                range.upper = std::max(range.upper, v);
+              }
+            }
+          }
+          grid.valueRanges[i] = range;
+        }
+      });
+
+  setMacrocells(std::move(grid));
 }
 
-float StructuredRegularField::valueAtVoxel(const uint3 &index) const
+template <typename T>
+void StructuredRegularField::setupSampler(bool bricked)
 {
-  const size_t i = size_t(index.x)
-      + m_dims.x * (size_t(index.y) + m_dims.y * size_t(index.z));
-
-  switch (m_type) {
-  case ANARI_FLOAT32:
-    return ((float *)m_data)[i];
-  case ANARI_FLOAT64:
-    return ((double *)m_data)[i];
-  case ANARI_UFIXED8:
-    return ((uint8_t *)m_data)[i] / float(std::numeric_limits<uint8_t>::max());
-  case ANARI_UFIXED16:
-    return ((uint16_t *)m_data)[i]
-        / float(std::numeric_limits<uint16_t>::max());
-  case ANARI_FIXED16:
-    return ((int16_t *)m_data)[i] / float(std::numeric_limits<int16_t>::max());
-  default:
-    break;
-  }
+  buildMacrocells<T>();
 
-  return NAN;
+  if (bricked) {
+    brickData<T>();
+    m_sampler = &StructuredRegularField::sampleVoxels<T, true>;
+  } else
+    m_sampler = &StructuredRegularField::sampleVoxels<T, false>;
 }
 
 } // namespace helide
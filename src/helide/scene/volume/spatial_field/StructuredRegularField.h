@@ -5,6 +5,8 @@
 
 #include "SpatialField.h"
 #include "array/Array3D.h"
+// std
+#include <vector>
 
 namespace helide {
 
@@ -22,7 +24,19 @@ struct StructuredRegularField : public SpatialField
 
  private:
   float3 objectToLocal(const float3 &object) const;
+  size_t brickedIndex(const uint3 &index) const;
+
+  template <typename T, bool BRICKED>
   float valueAtVoxel(const uint3 &index) const;
+  template <typename T, bool BRICKED>
+  float sampleVoxels(const float3 &local) const;
+
+  template <typename T>
+  void brickData();
+  template <typename T>
+  void buildMacrocells();
+  template <typename T>
+  void setupSampler(bool bricked);
 
   // Data //
 
@@ -32,10 +46,28 @@ struct StructuredRegularField : public SpatialField
   float3 m_invSpacing;
   float3 m_coordUpperBound;
 
-  helium::IntrusivePtr<Array3D> m_dataArray;
+  helium::ChangeObserverPtr<Array3D> m_dataArray;
 
   const void *m_data{nullptr};
   anari::DataType m_type{ANARI_UNKNOWN};
+
+  // Copy of the data in 8^3 voxel bricks, used with dataLayout "bricked"
+  std::vector<uint8_t> m_brickedData;
+  uint3 m_numBricks{0u};
+
+  using Sampler = float (StructuredRegularField::*)(const float3 &) const;
+  Sampler m_sampler{nullptr};
 };
 
+// Inlined definitions ////////////////////////////////////////////////////////
+
+inline size_t StructuredRegularField::brickedIndex(const uint3 &index) const
+{
+  const uint3 b(index.x >> 3, index.y >> 3, index.z >> 3);
+  const uint3 o(index.x & 7, index.y & 7, index.z & 7);
+  const size_t brick =
+      b.x + m_numBricks.x * (size_t(b.y) + m_numBricks.y * size_t(b.z));
+  return brick * 512 + o.x + 8 * (o.y + 8 * o.z);
+}
+
 } // namespace helide
@@ -42,6 +42,12 @@ void BaseGlobalDeviceState::commitBufferClear()
   m_commitBuffer.clear();
 }
 
+bool BaseGlobalDeviceState::commitBufferEmpty() const
+{
+  std::lock_guard<std::mutex> guard(m_mutex);
+  return m_commitBuffer.empty();
+}
+
 TimeStamp BaseGlobalDeviceState::commitBufferLastFlush() const
 {
   std::lock_guard<std::mutex> guard(m_mutex);
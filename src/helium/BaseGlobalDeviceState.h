@@ -23,6 +23,7 @@ struct BaseGlobalDeviceState
   void commitBufferAddObject(BaseObject *o);
   void commitBufferFlush();
   void commitBufferClear();
+  bool commitBufferEmpty() const;
   TimeStamp commitBufferLastFlush() const;
 
   // Data //
@@ -29,7 +29,9 @@ bool BaseArray::isValid() const
 Array::Array(ANARIDataType type,
     BaseGlobalDeviceState *state,
     const ArrayMemoryDescriptor &d)
-    : BaseArray(type, state), m_elementType(d.elementType)
+    : BaseArray(type, state),
+      m_elementType(d.elementType),
+      m_attributeReader(attributeReaderFor(d.elementType))
 {
   if (d.appMemory) {
     m_ownership =
@@ -128,6 +130,11 @@ void Array::markDataModified()
   m_lastDataModified = helium::newTimeStamp();
 }
 
+helium::TimeStamp Array::lastDataModified() const
+{
+  return m_lastDataModified;
+}
+
 bool Array::isOffloaded() const
 {
   return m_isOffloaded;
@@ -212,8 +219,9 @@ void Array::initManagedMemory()
 
   if (ownership() == ArrayDataOwnership::MANAGED) {
     auto totalBytes = totalSize() * anari::sizeOf(elementType());
-    m_hostData.managed.mem = malloc(totalBytes);
-    std::memset(m_hostData.managed.mem, 0, totalBytes);
+    // calloc() hands out zero pages without touching them, so they are
+    // placed (e.g. by a NUMA policy) where the array is first written
+    m_hostData.managed.mem = calloc(totalBytes, 1);
   }
 }
 
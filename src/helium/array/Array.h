@@ -58,6 +58,9 @@ struct Array : public BaseArray
   ANARIDataType elementType() const;
   ArrayDataOwnership ownership() const;
 
+  // Reader for the element type, resolved once when the array is created
+  AttributeReader attributeReader() const;
+
   const void *data() const;
 
   template <typename T>
@@ -75,6 +78,7 @@ struct Array : public BaseArray
   bool wasPrivatized() const;
 
   void markDataModified();
+  helium::TimeStamp lastDataModified() const;
 
   bool isOffloaded() const;
   void markDataIsOffloaded(bool isOffloaded = true);
@@ -129,12 +133,18 @@ struct Array : public BaseArray
  private:
   ArrayDataOwnership m_ownership{ArrayDataOwnership::INVALID};
   ANARIDataType m_elementType{ANARI_UNKNOWN};
+  AttributeReader m_attributeReader{nullptr};
   bool m_privatized{false};
   mutable bool m_isOffloaded{false};
 };
 
 // Inlined definitions ////////////////////////////////////////////////////////
 
+inline AttributeReader Array::attributeReader() const
+{
+  return m_attributeReader;
+}
+
 template <typename T>
 inline const T *Array::dataAs() const
 {
@@ -70,7 +70,7 @@ size_t Array1D::size() const
 float4 Array1D::readAsAttributeValue(int32_t i, WrapMode wrap) const
 {
   const auto idx = calculateWrapIndex(i, size(), wrap);
-  return readAsAttributeValueFlat(begin(), elementType(), idx);
+  return attributeReader()(begin(), idx);
 }
 
 void Array1D::privatize()
@@ -35,7 +35,7 @@ float4 Array2D::readAsAttributeValue(
   const auto i_x = calculateWrapIndex(i.x, size().x, wrap1);
   const auto i_y = calculateWrapIndex(i.y, size().y, wrap2);
   const size_t idx = i_y * size().x + i_x;
-  return readAsAttributeValueFlat(data(), elementType(), idx);
+  return attributeReader()(data(), idx);
 }
 
 void Array2D::privatize()
@@ -265,83 +265,78 @@ static anari::math::float4 getAttributeArrayAt_ufixed(
   return retval;
 }
 
-inline anari::math::float4 readAsAttributeValueFlat(
-    const void *data, ANARIDataType type, uint64_t i)
+// Reads element 'i' of an array of a given element type as a float4
+using AttributeReader = anari::math::float4 (*)(const void *data, uint64_t i);
+
+template <typename T>
+static anari::math::float4 getAttributeArrayAt_float(
+    const void *data, uint64_t offset)
 {
   auto retval = DEFAULT_ATTRIBUTE_VALUE;
+  std::memcpy(&retval, typedOffset<T>(data, offset), sizeof(T));
+  return retval;
+}
+
+static anari::math::float4 getAttributeArrayAt_unknown(const void *, uint64_t)
+{
+  return DEFAULT_ATTRIBUTE_VALUE;
+}
 
+// Select the reader for an element type once, outside of reading loops
+inline AttributeReader attributeReaderFor(ANARIDataType type)
+{
   switch (type) {
   case ANARI_FLOAT32:
-    std::memcpy(&retval, typedOffset<float>(data, i), sizeof(float));
-    break;
+    return getAttributeArrayAt_float<float>;
   case ANARI_FLOAT32_VEC2:
-    std::memcpy(&retval,
-        typedOffset<anari::math::float2>(data, i),
-        sizeof(anari::math::float2));
-    break;
+    return getAttributeArrayAt_float<anari::math::float2>;
   case ANARI_FLOAT32_VEC3:
-    std::memcpy(&retval,
-        typedOffset<anari::math::float3>(data, i),
-        sizeof(anari::math::float3));
-    break;
+    return getAttributeArrayAt_float<anari::math::float3>;
   case ANARI_FLOAT32_VEC4:
-    std::memcpy(&retval,
-        typedOffset<anari::math::float4>(data, i),
-        sizeof(anari::math::float4));
-    break;
+    return getAttributeArrayAt_float<anari::math::float4>;
   case ANARI_UFIXED8_R_SRGB:
-    retval = getAttributeArrayAt_ufixed<uint8_t, 1, true>(data, i);
-    break;
+    return getAttributeArrayAt_ufixed<uint8_t, 1, true>;
   case ANARI_UFIXED8_RA_SRGB:
-    retval = getAttributeArrayAt_ufixed<uint8_t, 2, true>(data, i);
-    break;
+    return getAttributeArrayAt_ufixed<uint8_t, 2, true>;
   case ANARI_UFIXED8_RGB_SRGB:
-    retval = getAttributeArrayAt_ufixed<uint8_t, 3, true>(data, i);
-    break;
+    return getAttributeArrayAt_ufixed<uint8_t, 3, true>;
   case ANARI_UFIXED8_RGBA_SRGB:
-    retval = getAttributeArrayAt_ufixed<uint8_t, 4, true>(data, i);
-    break;
+    return getAttributeArrayAt_ufixed<uint8_t, 4, true>;
   case ANARI_UFIXED8:
-    retval = getAttributeArrayAt_ufixed<uint8_t, 1>(data, i);
-    break;
+    return getAttributeArrayAt_ufixed<uint8_t, 1>;
   case ANARI_UFIXED8_VEC2:
-    retval = getAttributeArrayAt_ufixed<uint8_t, 2>(data, i);
-    break;
+    return getAttributeArrayAt_ufixed<uint8_t, 2>;
   case ANARI_UFIXED8_VEC3:
-    retval = getAttributeArrayAt_ufixed<uint8_t, 3>(data, i);
-    break;
+    return getAttributeArrayAt_ufixed<uint8_t, 3>;
   case ANARI_UFIXED8_VEC4:
-    retval = getAttributeArrayAt_ufixed<uint8_t, 4>(data, i);
-    break;
+    return getAttributeArrayAt_ufixed<uint8_t, 4>;
   case ANARI_UFIXED16:
-    retval = getAttributeArrayAt_ufixed<uint16_t, 1>(data, i);
-    break;
+    return getAttributeArrayAt_ufixed<uint16_t, 1>;
   case ANARI_UFIXED16_VEC2:
-    retval = getAttributeArrayAt_ufixed<uint16_t, 2>(data, i);
-    break;
+    return getAttributeArrayAt_ufixed<uint16_t, 2>;
   case ANARI_UFIXED16_VEC3:
-    retval = getAttributeArrayAt_ufixed<uint16_t, 3>(data, i);
-    break;
+    return getAttributeArrayAt_ufixed<uint16_t, 3>;
   case ANARI_UFIXED16_VEC4:
-    retval = getAttributeArrayAt_ufixed<uint16_t, 4>(data, i);
-    break;
+    return getAttributeArrayAt_ufixed<uint16_t, 4>;
   case ANARI_UFIXED32:
-    retval = getAttributeArrayAt_ufixed<uint32_t, 1>(data, i);
-    break;
+    return getAttributeArrayAt_ufixed<uint32_t, 1>;
   case ANARI_UFIXED32_VEC2:
-    retval = getAttributeArrayAt_ufixed<uint32_t, 2>(data, i);
-    break;
+    return getAttributeArrayAt_ufixed<uint32_t, 2>;
   case ANARI_UFIXED32_VEC3:
-    retval = getAttributeArrayAt_ufixed<uint32_t, 3>(data, i);
-    break;
+    return getAttributeArrayAt_ufixed<uint32_t, 3>;
   case ANARI_UFIXED32_VEC4:
-    retval = getAttributeArrayAt_ufixed<uint32_t, 4>(data, i);
-    break;
+    return getAttributeArrayAt_ufixed<uint32_t, 4>;
   default:
     break;
   }
 
-  return retval;
+  return getAttributeArrayAt_unknown;
+}
+
+inline anari::math::float4 readAsAttributeValueFlat(
+    const void *data, ANARIDataType type, uint64_t i)
+{
+  return attributeReaderFor(type)(data, i);
 }
 
 } // namespace helium::math
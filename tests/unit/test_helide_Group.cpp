@@ -0,0 +1,172 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "catch.hpp"
+// anari
+#define ANARI_EXTENSION_UTILITY_IMPL
+#define ANARI_LINALG_DEFINITIONS
+#include "anari/anari_cpp.hpp"
+#include "anari/anari_cpp/ext/linalg.h"
+// std
+#include <cstdio>
+
+namespace {
+
+using namespace anari::math;
+
+void statusFunc(const void *,
+    ANARIDevice,
+    ANARIObject,
+    ANARIDataType,
+    ANARIStatusSeverity severity,
+    ANARIStatusCode,
+    const char *message)
+{
+  if (severity <= ANARI_SEVERITY_ERROR)
+    fprintf(stderr, "[helide] %s\n", message);
+}
+
+anari::Geometry makeTriangle(anari::Device d, float z)
+{
+  const float3 positions[] = {
+      float3(-1.f, -1.f, z), float3(1.f, -1.f, z), float3(0.f, 1.f, z)};
+  auto geom = anari::newObject<anari::Geometry>(d, "triangle");
+  anari::setParameterArray1D(d, geom, "vertex.position", positions, 3);
+  anari::commitParameters(d, geom);
+  return geom;
+}
+
+anari::Volume makeVolume(anari::Device d)
+{
+  const float voxels[] = {0.f, 1.f, 0.f, 1.f, 1.f, 0.f, 1.f, 0.f};
+  auto field = anari::newObject<anari::SpatialField>(d, "structuredRegular");
+  anari::setParameterArray3D(d, field, "data", voxels, 2, 2, 2);
+  anari::commitParameters(d, field);
+
+  const float3 colors[] = {float3(0.f), float3(1.f)};
+  const float opacities[] = {0.f, 1.f};
+  auto volume = anari::newObject<anari::Volume>(d, "transferFunction1D");
+  anari::setAndReleaseParameter(d, volume, "value", field);
+  anari::setParameterArray1D(d, volume, "color", colors, 2);
+  anari::setParameterArray1D(d, volume, "opacity", opacities, 2);
+  anari::setParameterAs(
+      d, volume, "valueRange", ANARI_FLOAT32_BOX1, float2(0.f, 1.f));
+  anari::commitParameters(d, volume);
+  return volume;
+}
+
+uint32_t renderAndCountBLSRebuilds(anari::Device d, anari::Frame f)
+{
+  anari::render(d, f);
+  anari::wait(d, f);
+  uint32_t rebuilds = ~0u;
+  REQUIRE(anari::getProperty(d, f, "stats.blsRebuilds", rebuilds));
+  return rebuilds;
+}
+
+} // namespace
+
+SCENARIO("helide::Group only rebuilds its BLS when its content changes",
+    "[helide_Group]")
+{
+  auto library = anari::loadLibrary("helide", statusFunc);
+  REQUIRE(library != nullptr);
+  auto d = anari::newDevice(library, "default");
+  REQUIRE(d != nullptr);
+
+  auto geom = makeTriangle(d, 0.f);
+  auto material = anari::newObject<anari::Material>(d, "matte");
+  anari::commitParameters(d, material);
+
+  auto surface = anari::newObject<anari::Surface>(d);
+  anari::setParameter(d, surface, "geometry", geom);
+  anari::setParameter(d, surface, "material", material);
+  anari::commitParameters(d, surface);
+
+  auto volume = makeVolume(d);
+
+  auto group = anari::newObject<anari::Group>(d);
+  anari::setParameterArray1D(d, group, "surface", &surface, 1);
+  anari::setParameterArray1D(d, group, "volume", &volume, 1);
+  anari::commitParameters(d, group);
+
+  auto instance = anari::newObject<anari::Instance>(d, "transform");
+  anari::setAndReleaseParameter(d, instance, "group", group);
+  anari::commitParameters(d, instance);
+
+  auto world = anari::newObject<anari::World>(d);
+  anari::setParameterArray1D(d, world, "instance", &instance, 1);
+  anari::release(d, instance);
+  anari::commitParameters(d, world);
+
+  auto camera = anari::newObject<anari::Camera>(d, "perspective");
+  anari::setParameter(d, camera, "position", float3(0.5f, 0.5f, 3.f));
+  anari::setParameter(d, camera, "direction", float3(0.f, 0.f, -1.f));
+  anari::commitParameters(d, camera);
+
+  auto renderer = anari::newObject<anari::Renderer>(d, "default");
+  anari::commitParameters(d, renderer);
+
+  auto frame = anari::newObject<anari::Frame>(d);
+  anari::setParameter(d, frame, "size", uint2(16, 16));
+  anari::setParameter(d, frame, "channel.color", ANARI_UFIXED8_RGBA_SRGB);
+  anari::setAndReleaseParameter(d, frame, "world", world);
+  anari::setAndReleaseParameter(d, frame, "camera", camera);
+  anari::setAndReleaseParameter(d, frame, "renderer", renderer);
+  anari::commitParameters(d, frame);
+
+  GIVEN("A frame which built the group's BLS")
+  {
+    REQUIRE(renderAndCountBLSRebuilds(d, frame) == 1);
+    REQUIRE(renderAndCountBLSRebuilds(d, frame) == 0);
+
+    WHEN("The surface is committed with a new material")
+    {
+      auto newMaterial = anari::newObject<anari::Material>(d, "matte");
+      anari::setParameter(d, newMaterial, "color", float3(1.f, 0.f, 0.f));
+      anari::commitParameters(d, newMaterial);
+      anari::setAndReleaseParameter(d, surface, "material", newMaterial);
+      anari::setParameter(d, surface, "id", 7u);
+      anari::commitParameters(d, surface);
+
+      THEN("The group's BLS is not reconstructed")
+      {
+        REQUIRE(renderAndCountBLSRebuilds(d, frame) == 0);
+      }
+    }
+
+    WHEN("The volume's transfer function is edited")
+    {
+      const float opacities[] = {0.5f, 0.25f};
+      anari::setParameterArray1D(d, volume, "opacity", opacities, 2);
+      anari::setParameterAs(
+          d, volume, "valueRange", ANARI_FLOAT32_BOX1, float2(0.f, 2.f));
+      anari::commitParameters(d, volume);
+
+      THEN("The group's BLS is not reconstructed")
+      {
+        REQUIRE(renderAndCountBLSRebuilds(d, frame) == 0);
+      }
+    }
+
+    WHEN("The surface is committed with a new geometry")
+    {
+      auto newGeom = makeTriangle(d, -1.f);
+      anari::setAndReleaseParameter(d, surface, "geometry", newGeom);
+      anari::commitParameters(d, surface);
+
+      THEN("The group's BLS is reconstructed")
+      {
+        REQUIRE(renderAndCountBLSRebuilds(d, frame) == 1);
+      }
+    }
+  }
+
+  anari::release(d, frame);
+  anari::release(d, volume);
+  anari::release(d, surface);
+  anari::release(d, material);
+  anari::release(d, geom);
+  anari::release(d, d);
+  anari::unloadLibrary(library);
+}
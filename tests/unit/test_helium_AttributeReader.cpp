@@ -0,0 +1,188 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "catch.hpp"
+// helium
+#include "helium/helium_math.h"
+// std
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+using namespace helium::math;
+using anari::math::float2;
+using anari::math::float3;
+using anari::math::float4;
+
+// The per-read switch attributeReaderFor() replaced, kept as the reference
+float4 referenceReadAsAttributeValue(
+    const void *data, ANARIDataType type, uint64_t i)
+{
+  auto retval = DEFAULT_ATTRIBUTE_VALUE;
+
+  switch (type) {
+  case ANARI_FLOAT32:
+    std::memcpy(&retval, typedOffset<float>(data, i), sizeof(float));
+    break;
+  case ANARI_FLOAT32_VEC2:
+    std::memcpy(&retval, typedOffset<float2>(data, i), sizeof(float2));
+    break;
+  case ANARI_FLOAT32_VEC3:
+    std::memcpy(&retval, typedOffset<float3>(data, i), sizeof(float3));
+    break;
+  case ANARI_FLOAT32_VEC4:
+    std::memcpy(&retval, typedOffset<float4>(data, i), sizeof(float4));
+    break;
+  case ANARI_UFIXED8_R_SRGB:
+    retval = getAttributeArrayAt_ufixed<uint8_t, 1, true>(data, i);
+    break;
+  case ANARI_UFIXED8_RA_SRGB:
+    retval = getAttributeArrayAt_ufixed<uint8_t, 2, true>(data, i);
+    break;
+  case ANARI_UFIXED8_RGB_SRGB:
+    retval = getAttributeArrayAt_ufixed<uint8_t, 3, true>(data, i);
+    break;
+  case ANARI_UFIXED8_RGBA_SRGB:
+    retval = getAttributeArrayAt_ufixed<uint8_t, 4, true>(data, i);
+    break;
+  case ANARI_UFIXED8:
+    retval = getAttributeArrayAt_ufixed<uint8_t, 1>(data, i);
+    break;
+  case ANARI_UFIXED8_VEC2:
+    retval = getAttributeArrayAt_ufixed<uint8_t, 2>(data, i);
+    break;
+  case ANARI_UFIXED8_VEC3:
+    retval = getAttributeArrayAt_ufixed<uint8_t, 3>(data, i);
+    break;
+  case ANARI_UFIXED8_VEC4:
+    retval = getAttributeArrayAt_ufixed<uint8_t, 4>(data, i);
+    break;
+  case ANARI_UFIXED16:
+    retval = getAttributeArrayAt_ufixed<uint16_t, 1>(data, i);
+    break;
+  case ANARI_UFIXED16_VEC2:
+    retval = getAttributeArrayAt_ufixed<uint16_t, 2>(data, i);
+    break;
+  case ANARI_UFIXED16_VEC3:
+    retval = getAttributeArrayAt_ufixed<uint16_t, 3>(data, i);
+    break;
+  case ANARI_UFIXED16_VEC4:
+    retval = getAttributeArrayAt_ufixed<uint16_t, 4>(data, i);
+    break;
+  case ANARI_UFIXED32:
+    retval = getAttributeArrayAt_ufixed<uint32_t, 1>(data, i);
+    break;
+  case ANARI_UFIXED32_VEC2:
+    retval = getAttributeArrayAt_ufixed<uint32_t, 2>(data, i);
+    break;
+  case ANARI_UFIXED32_VEC3:
+    retval = getAttributeArrayAt_ufixed<uint32_t, 3>(data, i);
+    break;
+  case ANARI_UFIXED32_VEC4:
+    retval = getAttributeArrayAt_ufixed<uint32_t, 4>(data, i);
+    break;
+  default:
+    break;
+  }
+
+  return retval;
+}
+
+template <typename T>
+inline void verify_reader(ANARIDataType type, const std::vector<T> &data)
+{
+  const auto numElements = data.size() * sizeof(T) / anari::sizeOf(type);
+  REQUIRE(numElements > 1);
+
+  auto reader = attributeReaderFor(type);
+  REQUIRE(reader != nullptr);
+
+  for (uint64_t i = 0; i < numElements; i++) {
+    const auto expected = referenceReadAsAttributeValue(data.data(), type, i);
+    const auto v = reader(data.data(), i);
+    REQUIRE(v.x == expected.x);
+    REQUIRE(v.y == expected.y);
+    REQUIRE(v.z == expected.z);
+    REQUIRE(v.w == expected.w);
+
+    const auto flat = readAsAttributeValueFlat(data.data(), type, i);
+    REQUIRE(flat.x == expected.x);
+    REQUIRE(flat.y == expected.y);
+    REQUIRE(flat.z == expected.z);
+    REQUIRE(flat.w == expected.w);
+  }
+}
+
+const std::vector<float> floats = {
+    0.f, 0.25f, -1.f, 2.5f, 3.f, -0.5f, 7.f, 1e6f, -8.f, 0.125f, 9.f, 10.f};
+
+const std::vector<uint8_t> u8 = {0, 1, 64, 127, 128, 200, 254, 255};
+
+const std::vector<uint16_t> u16 = {
+    0, 1, 1000, 32767, 32768, 50000, 65534, 65535};
+
+const std::vector<uint32_t> u32 = {
+    0u, 1u, 1000000u, 2147483647u, 2147483648u, 3000000000u, 4294967294u,
+    4294967295u};
+
+} // namespace
+
+TEST_CASE("helium::math::attributeReaderFor() float types",
+    "[helium_AttributeReader]")
+{
+  verify_reader(ANARI_FLOAT32, floats);
+  verify_reader(ANARI_FLOAT32_VEC2, floats);
+  verify_reader(ANARI_FLOAT32_VEC3, floats);
+  verify_reader(ANARI_FLOAT32_VEC4, floats);
+}
+
+TEST_CASE("helium::math::attributeReaderFor() ufixed types",
+    "[helium_AttributeReader]")
+{
+  verify_reader(ANARI_UFIXED8, u8);
+  verify_reader(ANARI_UFIXED8_VEC2, u8);
+  verify_reader(ANARI_UFIXED8_VEC3, std::vector<uint8_t>(24, 77));
+  verify_reader(ANARI_UFIXED8_VEC4, u8);
+  verify_reader(ANARI_UFIXED16, u16);
+  verify_reader(ANARI_UFIXED16_VEC2, u16);
+  verify_reader(ANARI_UFIXED16_VEC3, std::vector<uint16_t>(24, 4321));
+  verify_reader(ANARI_UFIXED16_VEC4, u16);
+  verify_reader(ANARI_UFIXED32, u32);
+  verify_reader(ANARI_UFIXED32_VEC2, u32);
+  verify_reader(ANARI_UFIXED32_VEC3, std::vector<uint32_t>(24, 123456789u));
+  verify_reader(ANARI_UFIXED32_VEC4, u32);
+
+  SECTION("Values are normalized to [0, 1]")
+  {
+    const auto v = attributeReaderFor(ANARI_UFIXED8_VEC2)(u8.data(), 3);
+    REQUIRE(v.x == 254 / 255.f);
+    REQUIRE(v.y == 1.f);
+    REQUIRE(v.z == 0.f);
+    REQUIRE(v.w == 1.f);
+  }
+}
+
+TEST_CASE("helium::math::attributeReaderFor() sRGB types",
+    "[helium_AttributeReader]")
+{
+  verify_reader(ANARI_UFIXED8_R_SRGB, u8);
+  verify_reader(ANARI_UFIXED8_RA_SRGB, u8);
+  verify_reader(ANARI_UFIXED8_RGB_SRGB, std::vector<uint8_t>(24, 77));
+  verify_reader(ANARI_UFIXED8_RGBA_SRGB, u8);
+}
+
+TEST_CASE("helium::math::attributeReaderFor() unknown types",
+    "[helium_AttributeReader]")
+{
+  verify_reader(ANARI_INT32, std::vector<int32_t>{1, 2, 3, 4});
+  verify_reader(ANARI_FLOAT64, std::vector<double>{1.0, 2.0});
+
+  auto reader = attributeReaderFor(ANARI_UNKNOWN);
+  REQUIRE(reader != nullptr);
+  const auto v = reader(nullptr, 0);
+  REQUIRE(v.x == DEFAULT_ATTRIBUTE_VALUE.x);
+  REQUIRE(v.y == DEFAULT_ATTRIBUTE_VALUE.y);
+  REQUIRE(v.z == DEFAULT_ATTRIBUTE_VALUE.z);
+  REQUIRE(v.w == DEFAULT_ATTRIBUTE_VALUE.w);
+}